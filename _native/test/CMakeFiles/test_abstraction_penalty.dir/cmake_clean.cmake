@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_abstraction_penalty.dir/abstraction_penalty.cpp.o"
+  "CMakeFiles/test_abstraction_penalty.dir/abstraction_penalty.cpp.o.d"
+  "test_abstraction_penalty"
+  "test_abstraction_penalty.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_abstraction_penalty.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_colored_range.dir/colored_range.cpp.o"
+  "CMakeFiles/test_colored_range.dir/colored_range.cpp.o.d"
+  "test_colored_range"
+  "test_colored_range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_colored_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_compressed_array.dir/compressed_array.cpp.o"
+  "CMakeFiles/test_compressed_array.dir/compressed_array.cpp.o.d"
+  "test_compressed_array"
+  "test_compressed_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_compressed_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
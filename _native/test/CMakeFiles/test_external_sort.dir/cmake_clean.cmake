@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_external_sort.dir/external_sort.cpp.o"
+  "CMakeFiles/test_external_sort.dir/external_sort.cpp.o.d"
+  "test_external_sort"
+  "test_external_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_external_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
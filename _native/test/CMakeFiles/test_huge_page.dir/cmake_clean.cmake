@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_huge_page.dir/huge_page.cpp.o"
+  "CMakeFiles/test_huge_page.dir/huge_page.cpp.o.d"
+  "test_huge_page"
+  "test_huge_page.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_huge_page.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
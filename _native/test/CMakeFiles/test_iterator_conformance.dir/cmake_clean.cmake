@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_iterator_conformance.dir/iterator_conformance.cpp.o"
+  "CMakeFiles/test_iterator_conformance.dir/iterator_conformance.cpp.o.d"
+  "test_iterator_conformance"
+  "test_iterator_conformance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_iterator_conformance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
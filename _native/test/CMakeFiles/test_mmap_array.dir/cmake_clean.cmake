@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mmap_array.dir/mmap_array.cpp.o"
+  "CMakeFiles/test_mmap_array.dir/mmap_array.cpp.o.d"
+  "test_mmap_array"
+  "test_mmap_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mmap_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_numa_placement.dir/numa_placement.cpp.o"
+  "CMakeFiles/test_numa_placement.dir/numa_placement.cpp.o.d"
+  "test_numa_placement"
+  "test_numa_placement.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numa_placement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
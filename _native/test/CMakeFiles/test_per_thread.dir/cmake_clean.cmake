@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_per_thread.dir/per_thread.cpp.o"
+  "CMakeFiles/test_per_thread.dir/per_thread.cpp.o.d"
+  "test_per_thread"
+  "test_per_thread.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_per_thread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
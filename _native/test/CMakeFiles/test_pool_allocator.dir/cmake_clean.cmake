@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pool_allocator.dir/pool_allocator.cpp.o"
+  "CMakeFiles/test_pool_allocator.dir/pool_allocator.cpp.o.d"
+  "test_pool_allocator"
+  "test_pool_allocator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pool_allocator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_roofline.dir/roofline.cpp.o"
+  "CMakeFiles/test_roofline.dir/roofline.cpp.o.d"
+  "test_roofline"
+  "test_roofline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_roofline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_scratch_arena.dir/scratch_arena.cpp.o"
+  "CMakeFiles/test_scratch_arena.dir/scratch_arena.cpp.o.d"
+  "test_scratch_arena"
+  "test_scratch_arena.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scratch_arena.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_stl_sort.dir/stl_sort.cpp.o"
+  "CMakeFiles/test_stl_sort.dir/stl_sort.cpp.o.d"
+  "test_stl_sort"
+  "test_stl_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stl_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
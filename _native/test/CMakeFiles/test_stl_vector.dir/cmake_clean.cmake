@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_stl_vector.dir/stl_vector.cpp.o"
+  "CMakeFiles/test_stl_vector.dir/stl_vector.cpp.o.d"
+  "test_stl_vector"
+  "test_stl_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stl_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_storage_cast.dir/storage_cast.cpp.o"
+  "CMakeFiles/test_storage_cast.dir/storage_cast.cpp.o.d"
+  "test_storage_cast"
+  "test_storage_cast.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_storage_cast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_strided_range.dir/strided_range.cpp.o"
+  "CMakeFiles/test_strided_range.dir/strided_range.cpp.o.d"
+  "test_strided_range"
+  "test_strided_range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_strided_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
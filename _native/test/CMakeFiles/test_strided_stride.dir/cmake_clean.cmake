@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_strided_stride.dir/strided_stride.cpp.o"
+  "CMakeFiles/test_strided_stride.dir/strided_stride.cpp.o.d"
+  "test_strided_stride"
+  "test_strided_stride.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_strided_stride.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
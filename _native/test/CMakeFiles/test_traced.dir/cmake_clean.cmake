@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_traced.dir/traced.cpp.o"
+  "CMakeFiles/test_traced.dir/traced.cpp.o.d"
+  "test_traced"
+  "test_traced.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_traced.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_uninitialized.dir/uninitialized.cpp.o"
+  "CMakeFiles/test_uninitialized.dir/uninitialized.cpp.o.d"
+  "test_uninitialized"
+  "test_uninitialized.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_uninitialized.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_web_example.dir/web_example.cpp.o"
+  "CMakeFiles/test_web_example.dir/web_example.cpp.o.d"
+  "test_web_example"
+  "test_web_example.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_web_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
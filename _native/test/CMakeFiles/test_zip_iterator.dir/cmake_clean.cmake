@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_zip_iterator.dir/zip_iterator.cpp.o"
+  "CMakeFiles/test_zip_iterator.dir/zip_iterator.cpp.o.d"
+  "test_zip_iterator"
+  "test_zip_iterator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_zip_iterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
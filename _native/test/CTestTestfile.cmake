@@ -0,0 +1,60 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_native/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(strided_range "test_strided_range")
+set_tests_properties(strided_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;54;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(strided_stride "test_strided_stride")
+set_tests_properties(strided_stride PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;55;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stl_sort "test_stl_sort")
+set_tests_properties(stl_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;56;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stl_vector "test_stl_vector")
+set_tests_properties(stl_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;57;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(web_example "test_web_example")
+set_tests_properties(web_example PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;58;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(zip_iterator "test_zip_iterator")
+set_tests_properties(zip_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;59;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(pipeline "test_pipeline")
+set_tests_properties(pipeline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;60;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(wavefront "test_wavefront")
+set_tests_properties(wavefront PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;61;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(colored_range "test_colored_range")
+set_tests_properties(colored_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;62;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(aligned_vector "test_aligned_vector")
+set_tests_properties(aligned_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;63;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(uninitialized "test_uninitialized")
+set_tests_properties(uninitialized PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;64;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(huge_page "test_huge_page")
+set_tests_properties(huge_page PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;65;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(numa_placement "test_numa_placement")
+set_tests_properties(numa_placement PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;66;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(scratch_arena "test_scratch_arena")
+set_tests_properties(scratch_arena PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;67;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(pool_allocator "test_pool_allocator")
+set_tests_properties(pool_allocator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;68;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(mmap_array "test_mmap_array")
+set_tests_properties(mmap_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;69;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(external_sort "test_external_sort")
+set_tests_properties(external_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;70;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(stream "test_stream")
+set_tests_properties(stream PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;71;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(compressed_array "test_compressed_array")
+set_tests_properties(compressed_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;72;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(storage_cast "test_storage_cast")
+set_tests_properties(storage_cast PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;73;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(iterator_conformance "test_iterator_conformance")
+set_tests_properties(iterator_conformance PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;74;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(roofline "test_roofline")
+set_tests_properties(roofline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;76;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(traced "test_traced")
+set_tests_properties(traced PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;77;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(abstraction_penalty "test_abstraction_penalty")
+set_tests_properties(abstraction_penalty PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;78;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(latency "test_latency")
+set_tests_properties(latency PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;83;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(per_thread "test_per_thread")
+set_tests_properties(per_thread PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;84;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(arena "test_arena")
+set_tests_properties(arena PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;41;add_test;/root/repo/test/CMakeLists.txt;85;add_pstl_test;/root/repo/test/CMakeLists.txt;0;")
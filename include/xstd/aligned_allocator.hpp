@@ -0,0 +1,172 @@
+/**
+ * \file       aligned_allocator.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::min
+#include <cassert>      // assert
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uintptr_t
+#include <limits>       // std::numeric_limits
+#include <new>          // std::align_val_t, std::bad_array_new_length
+#include <type_traits>  // std::true_type
+#include <vector>       // std::vector
+
+namespace xstd {
+
+/** Return pointer with a compile time alignment hint
+ *
+ * Tells the compiler ptr is aligned to Alignment bytes so
+ * kernels can skip peeling loops and use aligned vector
+ * instructions.  Behavior is undefined if ptr is not aligned.
+ */
+template <std::size_t Alignment, typename T>
+[[nodiscard]] inline T* assume_aligned(T* ptr) noexcept {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of 2");
+    assert(reinterpret_cast<std::uintptr_t>(ptr) % Alignment == 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<T*>(__builtin_assume_aligned(ptr, Alignment));
+#else
+    return ptr;
+#endif
+}
+
+/** Allocator returning memory with a configurable alignment
+ *
+ * Allocates memory aligned to Alignment bytes (64 by default
+ * so vectors start on a cache line).  An optional offset in
+ * bytes is added to the start of every allocation made by the
+ * allocator which can be used to stagger arrays that would
+ * otherwise map to the same cache sets (ex. 4K aliasing
+ * between two large power of 2 sized arrays).  The returned
+ * pointer is then only aligned to the largest power of 2
+ * dividing both the Alignment and the offset.
+ *
+ * \tparam T Type of value to allocate
+ * \tparam Alignment Alignment in bytes (power of 2)
+ *
+ * \code{.cpp}
+ * xstd::aligned_vector<double> x(N);                                  // 64 byte aligned
+ * xstd::aligned_vector<double> y(N, xstd::aligned_allocator<double>(512)); // 64 byte aligned + 512
+ * \endcode
+ */
+template <typename T, std::size_t Alignment = 64>
+class aligned_allocator {
+   public:
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of 2");
+    static_assert(Alignment >= alignof(T), "Alignment must be at least alignof(T)");
+
+    using value_type                             = T;
+    using size_type                              = std::size_t;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    static constexpr std::size_t alignment = Alignment;
+
+    template <typename U>
+    struct rebind {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() noexcept : offset_(0) {}
+
+    /** Allocator adding offset bytes to every allocation
+     */
+    explicit aligned_allocator(const std::size_t offset) noexcept : offset_(offset) {
+        assert(offset % alignof(T) == 0);
+    }
+
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Alignment>& other) noexcept : offset_(other.offset()) {}
+
+    /** Offset in bytes added to every allocation
+     */
+    std::size_t offset() const noexcept { return offset_; }
+
+    /** Alignment guaranteed for pointers returned by allocate
+     */
+    std::size_t guaranteed_alignment() const noexcept {
+        return offset_ == 0 ? Alignment : std::min<std::size_t>(Alignment, offset_ & (~offset_ + 1));
+    }
+
+    T* allocate(const std::size_t n) {
+        if (n > (std::numeric_limits<std::size_t>::max() - offset_) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        auto ptr = static_cast<char*>(::operator new(n * sizeof(T) + offset_, std::align_val_t(Alignment)));
+        return reinterpret_cast<T*>(ptr + offset_);
+    }
+
+    void deallocate(T* ptr, const std::size_t) noexcept {
+        ::operator delete(reinterpret_cast<char*>(ptr) - offset_, std::align_val_t(Alignment));
+    }
+
+    friend bool operator==(const aligned_allocator& x, const aligned_allocator& y) noexcept {
+        return x.offset_ == y.offset_;
+    }
+
+    friend bool operator!=(const aligned_allocator& x, const aligned_allocator& y) noexcept { return not(x == y); }
+
+   private:
+    std::size_t offset_;
+};
+
+/** std::vector using the aligned_allocator
+ */
+template <typename T, std::size_t Alignment = 64>
+using aligned_vector = std::vector<T, aligned_allocator<T, Alignment>>;
+
+/**
+ * @brief
+ * Proxy returned by aligned function
+ *
+ * Provides begin() and end() as raw pointers carrying the
+ * compile time alignment hint so they can be passed to the
+ * std:: algorithms or the xstd::strided and xstd::zip adaptors.
+ */
+template <typename T, std::size_t Alignment>
+struct aligned_proxy {
+    using value_type = T;
+    using iterator   = T*;
+
+    aligned_proxy() = delete;
+
+    aligned_proxy(T* first, const std::size_t size) : first_(first), size_(size) {}
+
+    ~aligned_proxy() = default;
+
+    T* begin() const noexcept { return xstd::assume_aligned<Alignment>(first_); }
+
+    T* end() const noexcept { return this->begin() + size_; }
+
+    T* data() const noexcept { return this->begin(); }
+
+    std::size_t size() const noexcept { return size_; }
+
+   private:
+    T* first_;
+    std::size_t size_;
+};
+
+/**
+ * @brief
+ * View of contiguous container with an alignment hint
+ *
+ * @details
+ * The container data must be aligned to Alignment which is
+ * checked in debug builds.
+ *
+ * \code{.cpp}
+ * xstd::aligned_vector<double> x(N);
+ * auto xa = xstd::aligned<64>(x);
+ * std::for_each(std::execution::par_unseq, xa.begin(), xa.end(), ...);
+ * for (auto v : xstd::zip(xa, xstd::aligned<64>(y))) { ... }
+ * \endcode
+ */
+template <std::size_t Alignment, typename Container>
+auto aligned(Container& content) -> aligned_proxy<std::remove_pointer_t<decltype(content.data())>, Alignment> {
+    return {content.data(), content.size()};
+}
+
+} /* namespace xstd */
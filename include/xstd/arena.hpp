@@ -0,0 +1,208 @@
+/**
+ * \file       arena.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>           // std::max
+#include <condition_variable>  // std::condition_variable
+#include <cstddef>             // std::size_t
+#include <deque>               // std::deque
+#include <functional>          // std::function
+#include <future>              // std::async, std::future, std::packaged_task
+#include <memory>              // std::make_shared
+#include <mutex>               // std::mutex, std::unique_lock
+#include <thread>              // std::thread
+#include <type_traits>         // std::invoke_result_t
+#include <utility>             // std::forward, std::move
+
+#if __has_include(<tbb/task_arena.h>)
+#include <tbb/task_arena.h>
+#define XSTD_ARENA_TBB 1
+#else
+#define XSTD_ARENA_TBB 0
+#endif
+
+#if !XSTD_ARENA_TBB && defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace xstd {
+namespace detail {
+
+/// Threads of the arena the calling thread runs in (0 if none)
+/// when there is no TBB arena to ask
+inline thread_local std::size_t arena_threads = 0;
+
+} /* namespace detail */
+
+/** Subset of threads to run parallel work on
+ *
+ * Parallel algorithms (std:: or xstd) called from work run with
+ * execute(f) use at most the arena's number of threads, the
+ * calling thread included.  Kernels which stop scaling once the
+ * memory bandwidth is saturated can then run side by side with
+ * async(f) on arenas splitting the cores instead of one after
+ * the other on all of them.
+ *
+ * With TBB (the backend of the parallel algorithms) the arena is
+ * a tbb::task_arena.  Without it the arena owns a dedicated
+ * std::thread running the work passed to async(f) in order.
+ * Backends built on OpenMP (such as NVHPC -stdpar=multicore
+ * compiled with OpenMP enabled) are confined by setting the
+ * OpenMP thread count for the duration of execute(f), so the
+ * team of each arena is its thread and the OpenMP threads it
+ * starts.  Serial backends ignore the thread count.
+ *
+ * \code{.cpp}
+ * xstd::arena left(8), right(8);
+ * auto a = left.async([&]() { std::sort(std::execution::par, x.begin(), x.end()); });
+ * auto b = right.async([&]() { std::transform(std::execution::par, ...); });
+ * a.get();
+ * b.get();
+ * \endcode
+ */
+class arena {
+   public:
+    /** Construct an arena of nthreads threads
+     */
+    explicit arena(const std::size_t nthreads = std::max(1U, std::thread::hardware_concurrency()))
+        : nthreads_(std::max<std::size_t>(nthreads, 1))
+#if XSTD_ARENA_TBB
+          ,
+          arena_(static_cast<int>(nthreads_))
+#endif
+    {
+#if !XSTD_ARENA_TBB
+        worker_ = std::thread([this]() { this->serve(); });
+#endif
+    }
+
+    arena(const arena&)            = delete;
+    arena& operator=(const arena&) = delete;
+
+#if !XSTD_ARENA_TBB
+    /** Finish the queued work and join the dedicated thread
+     */
+    ~arena() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        ready_.notify_one();
+        worker_.join();
+    }
+#endif
+
+    /** Number of threads of the arena
+     */
+    std::size_t concurrency() const { return nthreads_; }
+
+    /** Run f() in the arena and return its result
+     *
+     * The calling thread runs f() and waits until it returns.
+     */
+    template <typename Function>
+    std::invoke_result_t<Function> execute(Function&& f) {
+#if XSTD_ARENA_TBB
+        return arena_.execute(std::forward<Function>(f));
+#else
+        struct scope {
+            std::size_t outer = detail::arena_threads;
+#if defined(_OPENMP)
+            int outer_omp = omp_get_max_threads();
+#endif
+            explicit scope(const std::size_t n) {
+                detail::arena_threads = n;
+#if defined(_OPENMP)
+                omp_set_num_threads(static_cast<int>(n));
+#endif
+            }
+            ~scope() {
+                detail::arena_threads = outer;
+#if defined(_OPENMP)
+                omp_set_num_threads(outer_omp);
+#endif
+            }
+        } guard(nthreads_);
+        return std::forward<Function>(f)();
+#endif
+    }
+
+    /** Run f() in the arena on another thread
+     *
+     * Returns at once with the future result of f() so work in
+     * several arenas can run at the same time.  Without TBB the
+     * work of one arena runs in order on its dedicated thread.
+     * The arena must outlive the call.
+     */
+    template <typename Function>
+    std::future<std::invoke_result_t<Function>> async(Function f) {
+#if XSTD_ARENA_TBB
+        return std::async(std::launch::async, [this, f = std::move(f)]() mutable { return this->execute(f); });
+#else
+        using result_type = std::invoke_result_t<Function>;
+        auto task         = std::make_shared<std::packaged_task<result_type()>>(
+            [this, f = std::move(f)]() mutable { return this->execute(f); });
+        auto result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.emplace_back([task]() { (*task)(); });
+        }
+        ready_.notify_one();
+        return result;
+#endif
+    }
+
+    /** Threads of the arena the calling thread runs in
+     *
+     * The hardware threads when not inside any arena.
+     */
+    static std::size_t current_concurrency() {
+#if XSTD_ARENA_TBB
+        return static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+#else
+        if (detail::arena_threads > 0) {
+            return detail::arena_threads;
+        }
+#if defined(_OPENMP)
+        return static_cast<std::size_t>(omp_get_max_threads());
+#else
+        return std::max(1U, std::thread::hardware_concurrency());
+#endif
+#endif
+    }
+
+   private:
+    std::size_t nthreads_;
+#if XSTD_ARENA_TBB
+    tbb::task_arena arena_;
+#else
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+    std::thread worker_;
+
+    /** Run queued work on the dedicated thread until stopped
+     */
+    void serve() {
+        while (true) {
+            std::function<void()> work;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this]() { return stopping_ or not queue_.empty(); });
+                if (queue_.empty()) {
+                    return;
+                }
+                work = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            work();
+        }
+    }
+#endif
+};
+
+} /* namespace xstd */
@@ -0,0 +1,349 @@
+/**
+ * \file       arena_algorithm.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::sort, std::merge, std::for_each, std::copy, std::min, std::max
+#include <cstddef>      // std::size_t, std::ptrdiff_t
+#include <execution>    // std::execution::*
+#include <functional>   // std::less, std::plus
+#include <iterator>     // std::iterator_traits
+#include <numeric>      // std::accumulate, std::inclusive_scan
+#include <thread>       // std::thread::hardware_concurrency
+#include <type_traits>  // std::is_same_v, std::decay_t, std::is_trivially_copyable_v, std::enable_if_t
+#include <utility>      // std::forward
+
+#include "xstd/range.hpp"
+#include "xstd/scratch_arena.hpp"
+#include "xstd/traced.hpp"
+
+namespace xstd {
+namespace detail {
+
+/// Smallest number of elements worth a separate task
+inline constexpr std::ptrdiff_t arena_min_grain = 4096;
+
+template <typename Policy>
+inline constexpr bool is_parallel_policy_v =
+    std::is_same_v<std::decay_t<Policy>, std::execution::parallel_policy> or
+    std::is_same_v<std::decay_t<Policy>, std::execution::parallel_unsequenced_policy>;
+
+/// Enables the generic entry points for standard execution policies
+/// only (wrapped policies such as traced_policy have overloads)
+template <typename Policy>
+using enable_if_execution_policy_t = std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, int>;
+
+/** Number of blocks to split n elements into
+ *
+ * Several blocks per hardware thread for load balance
+ * while keeping every block above the minimum grain.
+ */
+inline std::ptrdiff_t arena_blocks(const std::ptrdiff_t n) {
+    const std::ptrdiff_t nthreads = std::max(1U, std::thread::hardware_concurrency());
+    return std::max<std::ptrdiff_t>(1, std::min(4 * nthreads, n / arena_min_grain));
+}
+
+/** Section of the merge of two sorted ranges
+ *
+ * Covers output positions [d_first, d_last) of merging
+ * a[a_first, a_first+na) with b[b_first, b_first+nb) into
+ * out[out_first, out_first+na+nb).
+ */
+struct merge_task {
+    std::ptrdiff_t a_first;
+    std::ptrdiff_t na;
+    std::ptrdiff_t b_first;
+    std::ptrdiff_t nb;
+    std::ptrdiff_t out_first;
+    std::ptrdiff_t d_first;
+    std::ptrdiff_t d_last;
+};
+
+/** Number of elements of a among the first d outputs of merging a and b
+ *
+ * Binary search along the diagonal d of the merge path.
+ * Ties are taken from a first matching std::merge.
+ */
+template <typename It1, typename It2, typename Compare>
+std::ptrdiff_t merge_path(It1 a, const std::ptrdiff_t na, It2 b, const std::ptrdiff_t nb, const std::ptrdiff_t d,
+                          Compare comp) {
+    std::ptrdiff_t lo = std::max<std::ptrdiff_t>(0, d - nb);
+    std::ptrdiff_t hi = std::min(d, na);
+    while (lo < hi) {
+        const auto mid = lo + (hi - lo) / 2;
+        if (comp(b[d - mid - 1], a[mid])) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+/** Split one merge into tasks of about grain outputs
+ *
+ * \return Number of tasks written
+ */
+inline std::ptrdiff_t add_merge_tasks(merge_task* tasks, const std::ptrdiff_t a_first, const std::ptrdiff_t na,
+                                      const std::ptrdiff_t b_first, const std::ptrdiff_t nb,
+                                      const std::ptrdiff_t out_first, const std::ptrdiff_t grain) {
+    const auto m      = na + nb;
+    const auto pieces = std::max<std::ptrdiff_t>(1, (m + grain - 1) / grain);
+    for (std::ptrdiff_t k = 0; k < pieces; ++k) {
+        tasks[k] = {a_first, na, b_first, nb, out_first, k * m / pieces, (k + 1) * m / pieces};
+    }
+    return pieces;
+}
+
+/** Perform the merge tasks using policy
+ */
+template <typename Policy, typename It1, typename It2, typename OutIt, typename Compare>
+void run_merge_tasks(Policy&& policy, const merge_task* tasks, const std::ptrdiff_t ntasks, It1 a, It2 b, OutIt out,
+                     Compare comp) {
+    auto indices = xstd::range(ntasks);
+    std::for_each(policy, indices.begin(), indices.end(), [=](auto t) {
+        const auto& task = tasks[t];
+        const auto a_ptr = a + task.a_first;
+        const auto b_ptr = b + task.b_first;
+        const auto i0    = merge_path(a_ptr, task.na, b_ptr, task.nb, task.d_first, comp);
+        const auto i1    = merge_path(a_ptr, task.na, b_ptr, task.nb, task.d_last, comp);
+        std::merge(a_ptr + i0, a_ptr + i1, b_ptr + (task.d_first - i0), b_ptr + (task.d_last - i1),
+                   out + task.out_first + task.d_first, comp);
+    });
+}
+
+} /* namespace detail */
+
+/** Sort a range taking temporary storage from an arena
+ *
+ * Sorts blocks of the range in parallel and then merges pairs
+ * of blocks in parallel (each merge split along its merge path)
+ * alternating between the range and a buffer taken from the
+ * arena.  Unlike std::sort(std::execution::par, ...) no memory
+ * is requested from the system once the arena is large enough.
+ *
+ * Sequenced policies and types which are not trivially
+ * copyable use std::sort directly.
+ *
+ * \param policy[in] Execution policy
+ * \param first[in] Beginning of range to sort
+ * \param last[in] End of range to sort
+ * \param arena[in] Arena providing the temporary buffer
+ * \param comp[in] Comparison function object
+ */
+template <typename Policy, typename RandomIt, typename Compare, detail::enable_if_execution_policy_t<Policy> = 0>
+void sort(Policy&& policy, RandomIt first, RandomIt last, scratch_arena& arena, Compare comp) {
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    if constexpr (not detail::is_parallel_policy_v<Policy> or not std::is_trivially_copyable_v<value_type>) {
+        std::sort(policy, first, last, comp);
+    } else {
+        const std::ptrdiff_t n       = last - first;
+        const std::ptrdiff_t nblocks = detail::arena_blocks(n);
+        if (nblocks < 2) {
+            std::sort(first, last, comp);
+            return;
+        }
+        auto bound = [=](std::ptrdiff_t b) { return std::min(b, nblocks) * n / nblocks; };
+
+        // Sort each block
+        auto blocks = xstd::range(nblocks);
+        std::for_each(policy, blocks.begin(), blocks.end(),
+                      [=](auto b) { std::sort(first + bound(b), first + bound(b + 1), comp); });
+
+        // Merge pairs of sorted runs until a single run remains
+        const auto grain  = std::max(detail::arena_min_grain, n / (4 * nblocks));
+        auto tasks        = arena.allocate<detail::merge_task>(n / grain + nblocks + 1);
+        auto buffer       = arena.allocate<value_type>(n);
+        bool in_buffer    = false;
+        for (std::ptrdiff_t width = 1; width < nblocks; width *= 2) {
+            std::ptrdiff_t ntasks = 0;
+            for (std::ptrdiff_t b = 0; b < nblocks; b += 2 * width) {
+                const auto lo  = bound(b);
+                const auto mid = bound(b + width);
+                const auto hi  = bound(b + 2 * width);
+                ntasks += detail::add_merge_tasks(tasks + ntasks, lo, mid - lo, mid, hi - mid, lo, grain);
+            }
+            if (in_buffer) {
+                detail::run_merge_tasks(policy, tasks, ntasks, buffer, buffer, first, comp);
+            } else {
+                detail::run_merge_tasks(policy, tasks, ntasks, first, first, buffer, comp);
+            }
+            in_buffer = not in_buffer;
+        }
+        if (in_buffer) {
+            std::copy(policy, buffer, buffer + n, first);
+        }
+    }
+}
+
+/** Sort a range taking temporary storage from an arena
+ */
+template <typename Policy, typename RandomIt, detail::enable_if_execution_policy_t<Policy> = 0>
+void sort(Policy&& policy, RandomIt first, RandomIt last, scratch_arena& arena) {
+    xstd::sort(std::forward<Policy>(policy), first, last, arena, std::less<>());
+}
+
+/** Inclusive scan taking temporary storage from an arena
+ *
+ * Two pass blocked scan.  The total of each block is reduced
+ * in parallel into storage taken from the arena, the block
+ * totals are scanned serially and then each block is scanned
+ * in parallel starting from the total of the blocks before it.
+ * The operation must be associative but need not be commutative.
+ *
+ * \param policy[in] Execution policy
+ * \param first[in] Beginning of input range
+ * \param last[in] End of input range
+ * \param d_first[in] Beginning of output range (may equal first)
+ * \param arena[in] Arena providing the temporary storage
+ * \param op[in] Binary associative operation
+ *
+ * \return Iterator to the element past the last element written
+ */
+template <typename Policy, typename RandomIt1, typename RandomIt2, typename BinaryOp,
+          detail::enable_if_execution_policy_t<Policy> = 0>
+RandomIt2 inclusive_scan(Policy&& policy, RandomIt1 first, RandomIt1 last, RandomIt2 d_first, scratch_arena& arena,
+                         BinaryOp op) {
+    using value_type = typename std::iterator_traits<RandomIt1>::value_type;
+
+    if constexpr (not detail::is_parallel_policy_v<Policy> or not std::is_trivially_copyable_v<value_type>) {
+        return std::inclusive_scan(policy, first, last, d_first, op);
+    } else {
+        const std::ptrdiff_t n       = last - first;
+        const std::ptrdiff_t nblocks = detail::arena_blocks(n);
+        if (nblocks < 2) {
+            return std::inclusive_scan(first, last, d_first, op);
+        }
+        auto bound = [=](std::ptrdiff_t b) { return b * n / nblocks; };
+
+        // Total of each block
+        auto totals = arena.allocate<value_type>(nblocks);
+        auto blocks = xstd::range(nblocks);
+        std::for_each(policy, blocks.begin(), blocks.end(), [=](auto b) {
+            const auto lo = bound(b);
+            totals[b]     = std::accumulate(first + lo + 1, first + bound(b + 1), value_type(first[lo]), op);
+        });
+
+        // Total of all blocks up to and including each block
+        for (std::ptrdiff_t b = 1; b < nblocks; ++b) {
+            totals[b] = op(totals[b - 1], totals[b]);
+        }
+
+        // Scan each block from the total before it
+        std::for_each(policy, blocks.begin(), blocks.end(), [=](auto b) {
+            const auto lo = bound(b);
+            const auto hi = bound(b + 1);
+            if (b == 0) {
+                std::inclusive_scan(first + lo, first + hi, d_first + lo, op);
+            } else {
+                std::inclusive_scan(first + lo, first + hi, d_first + lo, op, totals[b - 1]);
+            }
+        });
+        return d_first + n;
+    }
+}
+
+/** Inclusive sum taking temporary storage from an arena
+ */
+template <typename Policy, typename RandomIt1, typename RandomIt2, detail::enable_if_execution_policy_t<Policy> = 0>
+RandomIt2 inclusive_scan(Policy&& policy, RandomIt1 first, RandomIt1 last, RandomIt2 d_first, scratch_arena& arena) {
+    return xstd::inclusive_scan(std::forward<Policy>(policy), first, last, d_first, arena, std::plus<>());
+}
+
+/** Merge two sorted ranges taking temporary storage from an arena
+ *
+ * The output is split into sections of about equal size whose
+ * inputs are found by a binary search along the merge path so
+ * every section is merged independently.  Only the description
+ * of the sections is taken from the arena.
+ *
+ * \param policy[in] Execution policy
+ * \param first1[in] Beginning of first sorted range
+ * \param last1[in] End of first sorted range
+ * \param first2[in] Beginning of second sorted range
+ * \param last2[in] End of second sorted range
+ * \param d_first[in] Beginning of output range
+ * \param arena[in] Arena providing the temporary storage
+ * \param comp[in] Comparison function object
+ *
+ * \return Iterator to the element past the last element written
+ */
+template <typename Policy, typename RandomIt1, typename RandomIt2, typename RandomIt3, typename Compare,
+          detail::enable_if_execution_policy_t<Policy> = 0>
+RandomIt3 merge(Policy&& policy, RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2,
+                RandomIt3 d_first, scratch_arena& arena, Compare comp) {
+    if constexpr (not detail::is_parallel_policy_v<Policy>) {
+        return std::merge(policy, first1, last1, first2, last2, d_first, comp);
+    } else {
+        const std::ptrdiff_t na = last1 - first1;
+        const std::ptrdiff_t nb = last2 - first2;
+        const std::ptrdiff_t n  = na + nb;
+        const auto nblocks      = detail::arena_blocks(n);
+        if (nblocks < 2) {
+            return std::merge(first1, last1, first2, last2, d_first, comp);
+        }
+        auto tasks        = arena.allocate<detail::merge_task>(nblocks);
+        const auto ntasks = detail::add_merge_tasks(tasks, 0, na, 0, nb, 0, (n + nblocks - 1) / nblocks);
+        detail::run_merge_tasks(policy, tasks, ntasks, first1, first2, d_first, comp);
+        return d_first + n;
+    }
+}
+
+/** Merge two sorted ranges taking temporary storage from an arena
+ */
+template <typename Policy, typename RandomIt1, typename RandomIt2, typename RandomIt3,
+          detail::enable_if_execution_policy_t<Policy> = 0>
+RandomIt3 merge(Policy&& policy, RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, RandomIt2 last2,
+                RandomIt3 d_first, scratch_arena& arena) {
+    return xstd::merge(std::forward<Policy>(policy), first1, last1, first2, last2, d_first, arena, std::less<>());
+}
+
+// ====================================================
+// Algorithms accepting a traced policy
+// ====================================================
+
+template <typename Policy, typename RandomIt, typename Compare>
+void sort(const execution::traced_policy<Policy>& policy, RandomIt first, RandomIt last, scratch_arena& arena,
+          Compare comp) {
+    detail::traced_call(policy, detail::traced_elements(first, last),
+                        [&](const Policy& p) { xstd::sort(p, first, last, arena, comp); });
+}
+
+template <typename Policy, typename RandomIt>
+void sort(const execution::traced_policy<Policy>& policy, RandomIt first, RandomIt last, scratch_arena& arena) {
+    xstd::sort(policy, first, last, arena, std::less<>());
+}
+
+template <typename Policy, typename RandomIt1, typename RandomIt2, typename BinaryOp>
+RandomIt2 inclusive_scan(const execution::traced_policy<Policy>& policy, RandomIt1 first, RandomIt1 last,
+                         RandomIt2 d_first, scratch_arena& arena, BinaryOp op) {
+    return detail::traced_call(policy, detail::traced_elements(first, last), [&](const Policy& p) {
+        return xstd::inclusive_scan(p, first, last, d_first, arena, op);
+    });
+}
+
+template <typename Policy, typename RandomIt1, typename RandomIt2>
+RandomIt2 inclusive_scan(const execution::traced_policy<Policy>& policy, RandomIt1 first, RandomIt1 last,
+                         RandomIt2 d_first, scratch_arena& arena) {
+    return xstd::inclusive_scan(policy, first, last, d_first, arena, std::plus<>());
+}
+
+template <typename Policy, typename RandomIt1, typename RandomIt2, typename RandomIt3, typename Compare>
+RandomIt3 merge(const execution::traced_policy<Policy>& policy, RandomIt1 first1, RandomIt1 last1, RandomIt2 first2,
+                RandomIt2 last2, RandomIt3 d_first, scratch_arena& arena, Compare comp) {
+    const auto elements = detail::traced_elements(first1, last1) + detail::traced_elements(first2, last2);
+    return detail::traced_call(policy, elements, [&](const Policy& p) {
+        return xstd::merge(p, first1, last1, first2, last2, d_first, arena, comp);
+    });
+}
+
+template <typename Policy, typename RandomIt1, typename RandomIt2, typename RandomIt3>
+RandomIt3 merge(const execution::traced_policy<Policy>& policy, RandomIt1 first1, RandomIt1 last1, RandomIt2 first2,
+                RandomIt2 last2, RandomIt3 d_first, scratch_arena& arena) {
+    return xstd::merge(policy, first1, last1, first2, last2, d_first, arena, std::less<>());
+}
+
+} /* namespace xstd */
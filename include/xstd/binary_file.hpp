@@ -0,0 +1,37 @@
+/**
+ * \file       binary_file.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <fstream>  // std::ifstream, std::ofstream
+#include <string>   // std::string
+
+namespace xstd {
+namespace detail {
+
+/** Open a binary file for reading
+ *
+ * Failures to open, read or seek throw std::ios_base::failure.
+ */
+inline std::ifstream open_input(const std::string& path) {
+    std::ifstream file;
+    file.exceptions(std::ios::failbit | std::ios::badbit);
+    file.open(path, std::ios::binary);
+    return file;
+}
+
+/** Create (or truncate) a binary file for writing
+ *
+ * Failures to open or write throw std::ios_base::failure.
+ */
+inline std::ofstream open_output(const std::string& path) {
+    std::ofstream file;
+    file.exceptions(std::ios::failbit | std::ios::badbit);
+    file.open(path, std::ios::binary | std::ios::trunc);
+    return file;
+}
+
+} /* namespace detail */
+} /* namespace xstd */
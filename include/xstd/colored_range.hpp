@@ -0,0 +1,266 @@
+/**
+ * \file       colored_range.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <cassert>   // assert
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <iterator>  // std::random_access_iterator_tag
+
+#include "xstd/extent.hpp"
+
+namespace xstd {
+
+/** Colorings of a structured grid
+ *
+ * red_black   : 2 colors with color = (i + j [+ k]) % 2
+ * multi_color : 2^N colors with one parity bit per dimension
+ *               (4 colors in 2-D, 8 colors in 3-D) where
+ *               color = (i%2)*2^(N-1) + ... + (k%2)
+ */
+enum class coloring { red_black, multi_color };
+
+/** Number of colors for a coloring of a N-dimensional grid
+ */
+template <std::size_t N>
+constexpr std::ptrdiff_t ncolors(const coloring order) {
+    return order == coloring::red_black ? 2 : (std::ptrdiff_t(1) << N);
+}
+
+namespace detail {
+
+/** Precomputed counts to decode the n-th point of a color
+ *
+ * For red-black orderings slice_[d][q] holds the number of points
+ * within dimensions d..N-1 whose coordinate sum has parity q and
+ * pair_[d] the number of points in two consecutive slices of d.
+ * For multi-color orderings count_[d] holds the number of indices
+ * along dimension d with the parity bit of the color.
+ */
+template <std::size_t N>
+struct color_layout {
+    nd_extent<N> extent_{};
+    nd_index<N> parity_{};
+    std::ptrdiff_t slice_[N][2]{};
+    std::ptrdiff_t count_[N]{};
+    std::ptrdiff_t size_;
+    coloring order_;
+    int color_;
+
+    color_layout() : size_(0), order_(coloring::red_black), color_(0) {}
+
+    color_layout(const nd_extent<N>& extent, const coloring order, const int color)
+        : extent_(extent), size_(0), order_(order), color_(color) {
+        assert(color >= 0 and color < ncolors<N>(order));
+        for (std::size_t d = 0; d < N; ++d) {
+            assert(extent[d] >= 0);
+        }
+
+        if (order_ == coloring::red_black) {
+            const auto last = N - 1;
+            for (int q = 0; q < 2; ++q) {
+                slice_[last][q] = (extent_[last] - q + 1) / 2;
+            }
+            for (std::size_t d = last; d-- > 0;) {
+                const auto pair = slice_[d + 1][0] + slice_[d + 1][1];
+                for (int q = 0; q < 2; ++q) {
+                    slice_[d][q] = (extent_[d] / 2) * pair + ((extent_[d] % 2) ? slice_[d + 1][q] : 0);
+                }
+            }
+            size_ = slice_[0][color_];
+        } else {
+            size_ = 1;
+            for (std::size_t d = 0; d < N; ++d) {
+                parity_[d] = (color_ >> (N - 1 - d)) & 1;
+                count_[d]  = (extent_[d] - parity_[d] + 1) / 2;
+                size_ *= count_[d];
+            }
+        }
+    }
+
+    /** Decode the n-th point of the color
+     */
+    nd_index<N> decode(std::ptrdiff_t n) const {
+        nd_index<N> index;
+        if (order_ == coloring::red_black) {
+            int q = color_;
+            for (std::size_t d = 0; d + 1 < N; ++d) {
+                const auto pair = slice_[d + 1][0] + slice_[d + 1][1];
+                const auto i    = 2 * (n / pair);
+                n               = n % pair;
+                if (n < slice_[d + 1][q]) {
+                    index[d] = i;
+                } else {
+                    index[d] = i + 1;
+                    n -= slice_[d + 1][q];
+                    q ^= 1;
+                }
+            }
+            index[N - 1] = q + 2 * n;
+        } else {
+            for (std::size_t d = N; d-- > 0;) {
+                index[d] = parity_[d] + 2 * (n % count_[d]);
+                n /= count_[d];
+            }
+        }
+        return index;
+    }
+};
+
+} /* namespace detail */
+
+/** Colored Iterator
+ *
+ * Random access iterator over the indices of all points of
+ * a single color within a structured N-dimensional grid.
+ * Dereferencing decodes the position into a nd_index<N>
+ * in O(N) operations so no index lists are stored.  Points
+ * are visited in lexicographic order.
+ *
+ * \tparam N Number of dimensions of the grid
+ */
+template <std::size_t N>
+struct colored_iterator {
+    // ====================================================
+    // Types
+    // ====================================================
+
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = nd_index<N>;
+    using pointer           = void;
+    using reference         = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    // ====================================================
+    // Constructors
+    // ====================================================
+
+    colored_iterator() : n_(0) {}
+
+    colored_iterator(const detail::color_layout<N>& layout, const difference_type n) : layout_(layout), n_(n) {}
+
+    // ====================================================
+    // Operators
+    // ====================================================
+
+    colored_iterator& operator++() {
+        ++n_;
+        return *this;
+    }
+
+    colored_iterator operator++(int) {
+        auto tmp = *this;
+        ++n_;
+        return tmp;
+    }
+
+    colored_iterator& operator+=(const difference_type& inc) {
+        n_ += inc;
+        return *this;
+    }
+
+    colored_iterator& operator--() {
+        --n_;
+        return *this;
+    }
+
+    colored_iterator operator--(int) {
+        auto tmp = *this;
+        --n_;
+        return tmp;
+    }
+
+    colored_iterator& operator-=(const difference_type& inc) {
+        n_ -= inc;
+        return *this;
+    }
+
+    reference operator[](const difference_type n) const { return layout_.decode(n_ + n); }
+
+    reference operator*() const { return layout_.decode(n_); }
+
+    // ====================================================
+    // Friend Operators
+    // ====================================================
+
+    friend bool operator==(const colored_iterator& x, const colored_iterator& y) { return x.n_ == y.n_; }
+
+    friend bool operator!=(const colored_iterator& x, const colored_iterator& y) { return x.n_ != y.n_; }
+
+    friend bool operator<(const colored_iterator& x, const colored_iterator& y) { return x.n_ < y.n_; }
+
+    friend bool operator>(const colored_iterator& x, const colored_iterator& y) { return x.n_ > y.n_; }
+
+    friend bool operator<=(const colored_iterator& x, const colored_iterator& y) { return x.n_ <= y.n_; }
+
+    friend bool operator>=(const colored_iterator& x, const colored_iterator& y) { return x.n_ >= y.n_; }
+
+    friend difference_type operator-(const colored_iterator& x, const colored_iterator& y) { return x.n_ - y.n_; }
+
+    friend colored_iterator operator+(colored_iterator x, difference_type y) { return x += y; }
+
+    friend colored_iterator operator+(difference_type x, colored_iterator y) { return y += x; }
+
+    friend colored_iterator operator-(colored_iterator x, difference_type y) { return x -= y; }
+
+   private:
+    detail::color_layout<N> layout_;
+    difference_type n_;
+};
+
+/**
+ * @brief
+ * Proxy returned by colored_range function
+ *
+ * This is the class returned by the colored_range() function
+ * within a range based for loop or parallel algorithm.
+ */
+template <std::size_t N>
+struct colored_proxy {
+    colored_proxy() = delete;
+
+    colored_proxy(const nd_extent<N>& extent, const coloring order, const int color) : layout_(extent, order, color) {}
+
+    ~colored_proxy() = default;
+
+    auto begin() const { return colored_iterator<N>(layout_, 0); }
+
+    auto end() const { return colored_iterator<N>(layout_, layout_.size_); }
+
+    auto cbegin() const { return this->begin(); }
+
+    auto cend() const { return this->end(); }
+
+    std::ptrdiff_t size() const { return layout_.size_; }
+
+   private:
+    detail::color_layout<N> layout_;
+};  // struct colored_proxy
+
+/**
+ * @brief
+ * Indices of all points of one color in a structured grid
+ *
+ * @details
+ * Enumerates the indices of a 2-D or 3-D grid having the requested
+ * color without building index lists.  Points of a single color are
+ * independent for 5/7-point (red-black) or 9/27-point (multi-color)
+ * stencils so each color can be updated with a parallel algorithm.
+ *
+ * \code{.cpp}
+ * for (int c = 0; c < xstd::ncolors<2>(xstd::coloring::red_black); ++c) {
+ *     auto points = xstd::colored_range<2>({ni, nj}, xstd::coloring::red_black, c);
+ *     std::for_each(std::execution::par, points.begin(), points.end(), [&](auto idx) {
+ *         update(idx[0], idx[1]);
+ *     });
+ * }
+ * \endcode
+ */
+template <std::size_t N>
+colored_proxy<N> colored_range(const nd_extent<N>& extent, const coloring order, const int color) {
+    return {extent, order, color};
+}
+
+} /* namespace xstd */
@@ -0,0 +1,557 @@
+/**
+ * \file       compressed_array.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::for_each, std::max, std::min
+#include <atomic>       // std::atomic
+#include <cmath>        // std::frexp, std::ldexp, std::nearbyint
+#include <cstddef>      // std::size_t, std::ptrdiff_t
+#include <cstdint>      // std::uint32_t, std::uint64_t, std::int64_t
+#include <cstring>      // std::memcpy
+#include <iterator>     // std::random_access_iterator_tag
+#include <limits>       // std::numeric_limits
+#include <numeric>      // std::inclusive_scan
+#include <stdexcept>    // std::invalid_argument
+#include <type_traits>  // std::conditional_t, std::is_floating_point_v, std::make_signed_t
+#include <vector>       // std::vector
+
+#include "xstd/range.hpp"
+
+namespace xstd {
+
+/** Compression applied to each block of a compressed_array
+ */
+enum class compression {
+    lossless,   ///< Delta of neighbouring bit patterns packed at the smallest width of the block
+    truncate,   ///< Lossless coding of values rounded to fewer mantissa bits (relative error bound)
+    fixed_rate  ///< Fixed-point values sharing an exponent per group (absolute error bound per group)
+};
+
+namespace detail {
+
+/// Values per compressed block (decoded into a thread local buffer)
+inline constexpr std::size_t compressed_block_size = 256;
+
+/// Values per group sharing an exponent in fixed rate blocks
+inline constexpr std::size_t compressed_group_size = 16;
+
+/// Decoded blocks cached per thread
+inline constexpr std::size_t compressed_cache_slots = 8;
+
+/// Bits used to store a group exponent in fixed rate blocks
+inline constexpr unsigned compressed_exponent_bits = 16;
+
+/// Unsigned integer with the bits of T
+template <typename T>
+using float_bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+/// Identifier for the contents of a compressed array (never reused)
+inline std::uint64_t next_compressed_id() {
+    static std::atomic<std::uint64_t> counter{0};
+    return ++counter;
+}
+
+/// Number of bits needed to hold value
+template <typename U>
+unsigned bit_width(U value) noexcept {
+    unsigned width = 0;
+    while (value != 0) {
+        value >>= 1;
+        ++width;
+    }
+    return width;
+}
+
+/** Writes values of 0 to 64 bits into consecutive words
+ */
+class bit_writer {
+   public:
+    explicit bit_writer(std::uint64_t* word) noexcept : word_(word) {}
+
+    /// Append the low n bits of value (higher bits must be zero)
+    void put(const std::uint64_t value, const unsigned n) noexcept {
+        if (n == 0) {
+            return;
+        }
+        *word_ = (pos_ == 0) ? value : (*word_ | (value << pos_));
+        pos_ += n;
+        if (pos_ >= 64) {
+            pos_ -= 64;
+            ++word_;
+            if (pos_ > 0) {
+                *word_ = value >> (n - pos_);
+            }
+        }
+    }
+
+   private:
+    std::uint64_t* word_;
+    unsigned pos_ = 0;
+};
+
+/** Value of the n (0 to 64) bits starting at bit pos of words
+ *
+ * Branch free so consecutive values decode independently.
+ * Always reads the word after the one holding pos.
+ */
+inline std::uint64_t read_bits(const std::uint64_t* words, const std::size_t pos, const unsigned n) noexcept {
+    const auto word    = words + pos / 64;
+    const unsigned off = pos % 64;
+    const auto value   = (word[0] >> off) | ((word[1] << 1) << (63 - off));
+    return (n == 64) ? value : (value & ((std::uint64_t(1) << n) - 1));
+}
+
+/** Encoder and decoder of the blocks of a compressed_array
+ *
+ * Delta blocks (lossless and truncate) store the first key
+ * followed by the zig-zag coded differences of neighbouring
+ * keys packed at the width of the largest difference.  The key
+ * of a value is its bit pattern shifted right by the number of
+ * mantissa bits dropped (after rounding).
+ *
+ * Fixed rate blocks store groups of values as signed integers
+ * of rate bits scaled by the largest exponent of the group.
+ */
+template <typename T>
+class block_codec {
+    using bits_type   = float_bits<T>;
+    using signed_bits = std::make_signed_t<bits_type>;
+
+    static constexpr unsigned value_bits    = sizeof(T) * 8;
+    static constexpr unsigned mantissa_bits = std::numeric_limits<T>::digits - 1;
+    static constexpr unsigned width_bits    = 7;
+
+   public:
+    block_codec() = default;
+
+    block_codec(const compression mode, const unsigned bits) : mode_(mode), bits_(bits) {
+        switch (mode) {
+            case compression::lossless:
+                bits_ = 0;
+                break;
+            case compression::truncate:
+                if (bits > mantissa_bits) {
+                    throw std::invalid_argument("compressed_array: more mantissa bits kept than stored");
+                }
+                drop_ = mantissa_bits - bits;
+                break;
+            case compression::fixed_rate:
+                if (bits < 2 or bits > 32) {
+                    throw std::invalid_argument("compressed_array: fixed rate must be 2 to 32 bits per value");
+                }
+                break;
+        }
+    }
+
+    compression mode() const noexcept { return mode_; }
+
+    unsigned bits() const noexcept { return bits_; }
+
+    /// Number of words needed to encode the n values at first
+    template <typename Iterator>
+    std::size_t words(Iterator first, const std::size_t n) const {
+        std::size_t nbits = 0;
+        if (mode_ == compression::fixed_rate) {
+            const auto ngroups = (n + compressed_group_size - 1) / compressed_group_size;
+            nbits              = ngroups * compressed_exponent_bits + n * bits_;
+        } else {
+            bits_type prev = this->key(first[0]);
+            unsigned width = 0;
+            for (std::size_t i = 1; i < n; ++i) {
+                const bits_type next = this->key(first[i]);
+                width                = std::max(width, bit_width(zigzag(next - prev)));
+                prev                 = next;
+            }
+            nbits = value_bits + width_bits + (n - 1) * width;
+        }
+        return (nbits + 63) / 64;
+    }
+
+    /// Encode the n values at first into words
+    template <typename Iterator>
+    void encode(Iterator first, const std::size_t n, std::uint64_t* words) const {
+        bit_writer out(words);
+        if (mode_ == compression::fixed_rate) {
+            const std::int64_t qmax = (std::int64_t(1) << (bits_ - 1)) - 1;
+            for (std::size_t g = 0; g < n; g += compressed_group_size) {
+                const auto last = std::min(n, g + compressed_group_size);
+                int exponent    = std::numeric_limits<int>::min();
+                for (std::size_t i = g; i < last; ++i) {
+                    int e;
+                    std::frexp(T(first[i]), &e);
+                    exponent = (T(first[i]) == T(0)) ? exponent : std::max(exponent, e);
+                }
+                exponent = (exponent == std::numeric_limits<int>::min()) ? 0 : exponent;
+                out.put(static_cast<std::uint16_t>(static_cast<std::int16_t>(exponent)), compressed_exponent_bits);
+
+                const int shift = static_cast<int>(bits_) - 1 - exponent;
+                for (std::size_t i = g; i < last; ++i) {
+                    auto q = static_cast<std::int64_t>(std::nearbyint(std::ldexp(T(first[i]), shift)));
+                    q      = std::max(-qmax, std::min(qmax, q));
+                    out.put(static_cast<std::uint64_t>(q) & mask(bits_), bits_);
+                }
+            }
+        } else {
+            bits_type prev = this->key(first[0]);
+            unsigned width = 0;
+            for (std::size_t i = 1; i < n; ++i) {
+                const bits_type next = this->key(first[i]);
+                width                = std::max(width, bit_width(zigzag(next - prev)));
+                prev                 = next;
+            }
+            prev = this->key(first[0]);
+            out.put(prev, value_bits);
+            out.put(width, width_bits);
+            for (std::size_t i = 1; i < n; ++i) {
+                const bits_type next = this->key(first[i]);
+                out.put(zigzag(next - prev), width);
+                prev = next;
+            }
+        }
+    }
+
+    /// Decode n values from words into values
+    void decode(const std::uint64_t* words, const std::size_t n, T* values) const noexcept {
+        std::size_t pos = 0;
+        if (mode_ == compression::fixed_rate) {
+            const unsigned shift = 64 - bits_;
+            for (std::size_t g = 0; g < n; g += compressed_group_size) {
+                const auto last     = std::min(n, g + compressed_group_size);
+                const auto exponent = static_cast<std::int16_t>(read_bits(words, pos, compressed_exponent_bits));
+                const T scale       = std::ldexp(T(1), exponent + 1 - static_cast<int>(bits_));
+                pos += compressed_exponent_bits;
+                for (std::size_t i = g; i < last; ++i) {
+                    const auto bits = read_bits(words, pos + (i - g) * bits_, bits_);
+                    const auto q    = static_cast<std::int64_t>(bits << shift) >> shift;  // Sign extend
+                    values[i]       = static_cast<T>(q) * scale;
+                }
+                pos += (last - g) * bits_;
+            }
+        } else {
+            auto key             = static_cast<bits_type>(read_bits(words, 0, value_bits));
+            const unsigned width = static_cast<unsigned>(read_bits(words, value_bits, width_bits));
+            pos                  = value_bits + width_bits - width;
+            values[0]            = this->value(key);
+            for (std::size_t i = 1; i < n; ++i) {
+                key += unzigzag(static_cast<bits_type>(read_bits(words, pos + i * width, width)));
+                values[i] = this->value(key);
+            }
+        }
+    }
+
+   private:
+    compression mode_ = compression::lossless;
+    unsigned bits_    = 0;
+    unsigned drop_    = 0;  // Mantissa bits dropped by truncate
+
+    static std::uint64_t mask(const unsigned n) noexcept {
+        return (n == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << n) - 1);
+    }
+
+    static bits_type zigzag(const bits_type delta) noexcept {
+        const auto s = static_cast<signed_bits>(delta);
+        return static_cast<bits_type>((delta << 1) ^ static_cast<bits_type>(s >> (value_bits - 1)));
+    }
+
+    static bits_type unzigzag(const bits_type code) noexcept {
+        return (code >> 1) ^ (bits_type(0) - (code & 1));
+    }
+
+    /// Bit pattern of x rounded to nearest and shifted right by the dropped bits
+    bits_type key(const T x) const noexcept {
+        bits_type bits;
+        std::memcpy(&bits, &x, sizeof(T));
+        if (drop_ == 0) {
+            return bits;
+        }
+        // Round to nearest unless Inf/NaN or the rounding overflows to Inf
+        const bits_type exponent = ((bits_type(1) << (value_bits - 1 - mantissa_bits)) - 1) << mantissa_bits;
+        const bits_type rounded  = bits + (bits_type(1) << (drop_ - 1));
+        const bool overflow      = ((bits & exponent) == exponent) or ((rounded & exponent) == exponent);
+        return (overflow ? bits : rounded) >> drop_;
+    }
+
+    T value(const bits_type key) const noexcept {
+        const bits_type bits = key << drop_;
+        T x;
+        std::memcpy(&x, &bits, sizeof(T));
+        return x;
+    }
+};
+
+/** Blocks decoded by the calling thread
+ *
+ * Direct mapped by array identifier and block index so a few
+ * neighbouring blocks of several arrays (ex. a stencil reading
+ * two fields) stay decoded together.
+ */
+template <typename T>
+struct compressed_block_cache {
+    struct slot {
+        std::uint64_t id  = 0;
+        std::size_t block = 0;
+        alignas(64) T values[compressed_block_size];
+    };
+    slot slots[compressed_cache_slots];
+};
+
+template <typename T>
+compressed_block_cache<T>& local_block_cache() noexcept {
+    static thread_local compressed_block_cache<T> cache;
+    return cache;
+}
+
+} /* namespace detail */
+
+/** Array of floating point values stored compressed in blocks
+ *
+ * Memory bound kernels which read a field many times can trade
+ * spare arithmetic for bandwidth by keeping the field
+ * compressed.  Values are compressed in blocks of 256 which are
+ * decoded independently so blocks are compressed and
+ * decompressed in parallel and random access only decodes the
+ * block holding the value.
+ *
+ * - compression::lossless stores the difference of neighbouring
+ *   bit patterns at the width of the largest difference in the
+ *   block.  Smooth fields shrink and values are exact.
+ * - compression::truncate first rounds every value to bits
+ *   mantissa bits (relative error at most 2^-bits) and then
+ *   codes the rounded values losslessly.
+ * - compression::fixed_rate stores every value with bits bits
+ *   (plus 1 bit per value for the exponent of each group of 16)
+ *   scaled by the largest exponent of its group as in ZFP's
+ *   fixed rate mode (without its decorrelating transform).  The
+ *   error of a value is at most 2^(1-bits) times the largest
+ *   magnitude in its group rounded up to a power of two.  Values
+ *   must be finite.
+ *
+ * Iterating decodes blocks on first access into a small
+ * thread local cache so the iterators can be passed to the
+ * std:: algorithms with any execution policy.  for_each_block
+ * hands whole decoded blocks to a function instead which avoids
+ * the per value cache lookup.  The contents are read-only.
+ *
+ * \tparam T Type of value stored (float or double)
+ *
+ * \code{.cpp}
+ * xstd::compressed_array<double> cx(std::execution::par, x.begin(), x.end(),
+ *                                   xstd::compression::truncate, 20);
+ * std::transform(std::execution::par, cx.begin(), cx.end(), y.begin(), y.begin(),
+ *                [a](double xval, double yval) { return yval + a * xval; });
+ * \endcode
+ */
+template <typename T>
+class compressed_array {
+    static_assert(std::is_floating_point_v<T>, "Compressed type must be float or double");
+    static_assert(sizeof(T) == 4 or sizeof(T) == 8, "Compressed type must be float or double");
+
+   public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /// Values per compressed block
+    static constexpr size_type block_size = detail::compressed_block_size;
+
+    /** Random access iterator decoding values on access
+     */
+    class const_iterator {
+       public:
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = T;
+        using iterator_category = std::random_access_iterator_tag;
+
+        const_iterator() = default;
+
+        const_iterator(const compressed_array* array, const size_type index) : array_(array), index_(index) {}
+
+        reference operator*() const { return array_->get(index_); }
+
+        reference operator[](const difference_type n) const { return array_->get(index_ + n); }
+
+        const_iterator& operator++() {
+            ++index_;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            auto tmp = *this;
+            ++index_;
+            return tmp;
+        }
+
+        const_iterator& operator--() {
+            --index_;
+            return *this;
+        }
+
+        const_iterator operator--(int) {
+            auto tmp = *this;
+            --index_;
+            return tmp;
+        }
+
+        const_iterator& operator+=(const difference_type n) {
+            index_ += n;
+            return *this;
+        }
+
+        const_iterator& operator-=(const difference_type n) {
+            index_ -= n;
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator x, const difference_type n) { return x += n; }
+
+        friend const_iterator operator+(const difference_type n, const_iterator x) { return x += n; }
+
+        friend const_iterator operator-(const_iterator x, const difference_type n) { return x -= n; }
+
+        friend difference_type operator-(const const_iterator& x, const const_iterator& y) {
+            return static_cast<difference_type>(x.index_) - static_cast<difference_type>(y.index_);
+        }
+
+        friend bool operator==(const const_iterator& x, const const_iterator& y) { return x.index_ == y.index_; }
+
+        friend bool operator!=(const const_iterator& x, const const_iterator& y) { return x.index_ != y.index_; }
+
+        friend bool operator<(const const_iterator& x, const const_iterator& y) { return x.index_ < y.index_; }
+
+        friend bool operator>(const const_iterator& x, const const_iterator& y) { return x.index_ > y.index_; }
+
+        friend bool operator<=(const const_iterator& x, const const_iterator& y) { return x.index_ <= y.index_; }
+
+        friend bool operator>=(const const_iterator& x, const const_iterator& y) { return x.index_ >= y.index_; }
+
+       private:
+        const compressed_array* array_ = nullptr;
+        size_type index_               = 0;
+    };
+
+    using iterator = const_iterator;
+
+    compressed_array() = default;
+
+    /** Compress the values [first, last) using policy
+     *
+     * \param policy[in] Execution policy used to compress the blocks
+     * \param first[in] Random access iterator to the first value
+     * \param last[in] Random access iterator past the last value
+     * \param mode[in] Compression of each block
+     * \param bits[in] Mantissa bits kept (truncate) or bits per value (fixed_rate, 2 to 32)
+     */
+    template <typename Policy, typename RandomIt>
+    compressed_array(Policy&& policy, RandomIt first, RandomIt last,
+                     const compression mode = compression::lossless, const unsigned bits = 0)
+        : codec_(mode, bits), size_(static_cast<size_type>(last - first)), id_(detail::next_compressed_id()) {
+        const auto nblocks = this->block_count();
+        auto blocks        = xstd::range(nblocks);
+
+        // Size every block, then place the blocks one after the other and encode them
+        offsets_.assign(nblocks + 1, 0);
+        std::for_each(policy, blocks.begin(), blocks.end(), [&](auto b) {
+            offsets_[b + 1] = codec_.words(first + b * block_size, this->block_length(b));
+        });
+        std::inclusive_scan(policy, offsets_.begin(), offsets_.end(), offsets_.begin());
+        words_.resize(offsets_.back() + 1);  // read_bits looks one word ahead
+        std::for_each(policy, blocks.begin(), blocks.end(), [&](auto b) {
+            codec_.encode(first + b * block_size, this->block_length(b), words_.data() + offsets_[b]);
+        });
+    }
+
+    // ====================================================
+    // Access
+    // ====================================================
+
+    size_type size() const noexcept { return size_; }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    compression mode() const noexcept { return codec_.mode(); }
+
+    /// Bytes of the compressed values and block offsets
+    size_type compressed_bytes() const noexcept {
+        return words_.size() * sizeof(std::uint64_t) + offsets_.size() * sizeof(size_type);
+    }
+
+    /// Uncompressed size divided by compressed size
+    double ratio() const noexcept {
+        return this->empty() ? 1.0 : double(size_ * sizeof(T)) / double(this->compressed_bytes());
+    }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    const_iterator cbegin() const noexcept { return this->begin(); }
+
+    const_iterator cend() const noexcept { return this->end(); }
+
+    /// Value at index i decoded through the thread local block cache
+    T operator[](const size_type i) const { return this->get(i); }
+
+    // ====================================================
+    // Block Operations
+    // ====================================================
+
+    /** Call f(index, values, n) for every decoded block using policy
+     *
+     * values points to the n decoded values starting at index in a
+     * buffer on the stack of the calling thread valid until f returns.
+     */
+    template <typename Policy, typename Function>
+    void for_each_block(Policy&& policy, Function f) const {
+        auto blocks = xstd::range(this->block_count());
+        std::for_each(policy, blocks.begin(), blocks.end(), [this, &f](auto b) {
+            T values[block_size];
+            codec_.decode(words_.data() + offsets_[b], this->block_length(b), values);
+            f(static_cast<size_type>(b) * block_size, static_cast<const T*>(values), this->block_length(b));
+        });
+    }
+
+    /** Decompress every value into d_first using policy
+     */
+    template <typename Policy, typename RandomIt>
+    RandomIt decompress(Policy&& policy, RandomIt d_first) const {
+        auto blocks = xstd::range(this->block_count());
+        std::for_each(policy, blocks.begin(), blocks.end(), [this, d_first](auto b) {
+            T values[block_size];
+            codec_.decode(words_.data() + offsets_[b], this->block_length(b), values);
+            std::copy(values, values + this->block_length(b), d_first + b * block_size);
+        });
+        return d_first + size_;
+    }
+
+   private:
+    detail::block_codec<T> codec_;
+    size_type size_ = 0;
+    std::uint64_t id_ = 0;
+    std::vector<size_type> offsets_;
+    std::vector<std::uint64_t> words_;
+
+    size_type block_count() const noexcept { return (size_ + block_size - 1) / block_size; }
+
+    size_type block_length(const size_type b) const noexcept { return std::min(block_size, size_ - b * block_size); }
+
+    /// Decoded values of block b from the thread local cache
+    const T* decoded(const size_type b) const {
+        auto& cache = detail::local_block_cache<T>();
+        auto& slot  = cache.slots[(2 * id_ + b) % detail::compressed_cache_slots];
+        if (slot.id != id_ or slot.block != b) {
+            codec_.decode(words_.data() + offsets_[b], this->block_length(b), slot.values);
+            slot.id    = id_;
+            slot.block = b;
+        }
+        return slot.values;
+    }
+
+    T get(const size_type i) const { return this->decoded(i / block_size)[i % block_size]; }
+};
+
+} /* namespace xstd */
@@ -0,0 +1,26 @@
+/**
+ * \file       extent.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <array>    // std::array
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+
+namespace xstd {
+
+/** Extent of a N-dimensional index space
+ *
+ * Number of indices along each dimension with the
+ * last dimension varying fastest.
+ */
+template <std::size_t N>
+using nd_extent = std::array<std::ptrdiff_t, N>;
+
+/** Index into a N-dimensional index space
+ */
+template <std::size_t N>
+using nd_index = std::array<std::ptrdiff_t, N>;
+
+} /* namespace xstd */
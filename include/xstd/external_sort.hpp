@@ -0,0 +1,407 @@
+/**
+ * \file       external_sort.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::sort, std::copy, std::upper_bound, std::min, std::max
+#include <cstddef>      // std::size_t, std::ptrdiff_t
+#include <filesystem>   // std::filesystem::*
+#include <fstream>      // std::ifstream, std::ofstream
+#include <functional>   // std::less
+#include <future>       // std::async, std::future
+#include <memory>       // std::unique_ptr, std::make_unique
+#include <random>       // std::random_device
+#include <string>       // std::string, std::to_string
+#include <thread>       // std::thread::hardware_concurrency
+#include <type_traits>  // std::is_trivially_copyable_v
+#include <utility>      // std::swap
+#include <vector>       // std::vector
+
+#include "xstd/arena_algorithm.hpp"
+#include "xstd/binary_file.hpp"
+#include "xstd/scratch_arena.hpp"
+#include "xstd/traced.hpp"
+#include "xstd/uninitialized.hpp"
+
+namespace xstd {
+namespace detail {
+
+/// Smallest block (bytes) read or written at a time while merging
+inline constexpr std::size_t external_min_block = std::size_t(1) << 20;
+
+/// Buffers of one block needed per run merged (2 read, 1 scratch, 2 write)
+inline constexpr std::size_t external_blocks_per_run = 5;
+
+/** Values per run so two run buffers and the sort scratch fit budget
+ *
+ * Parallel policies sort with xstd::sort taking a buffer of the
+ * run length and one merge task per arena_min_grain values (well
+ * under a byte per value) from an arena.  Sequenced policies sort
+ * in place.
+ */
+template <typename T, typename Policy>
+std::size_t external_run_size(const std::size_t budget) {
+    if constexpr (is_parallel_policy_v<Policy>) {
+        const std::size_t nthreads = std::max(1U, std::thread::hardware_concurrency());
+        const std::size_t fixed    = (4 * nthreads + 2) * sizeof(merge_task) + 3 * scratch_arena::block_alignment;
+        return std::max<std::size_t>((budget > fixed ? budget - fixed : 0) / (3 * sizeof(T) + 1), 1);
+    } else {
+        return std::max<std::size_t>(budget / (2 * sizeof(T)), 1);
+    }
+}
+
+/** Bytes of arena scratch used to sort a run of n values
+ */
+template <typename T, typename Policy>
+std::size_t external_sort_scratch(const std::size_t n) {
+    if constexpr (is_parallel_policy_v<Policy>) {
+        const auto ntasks = n / arena_min_grain + arena_blocks(n) + 1;
+        return n * sizeof(T) + ntasks * sizeof(merge_task) + 2 * scratch_arena::block_alignment;
+    } else {
+        return 0;
+    }
+}
+
+/** Temporary files removed when the guard goes out of scope
+ *
+ * Removes the files left behind when the sort throws.
+ */
+class temp_files {
+   public:
+    temp_files(const std::filesystem::path& dir, const std::string& prefix) : dir_(dir), prefix_(prefix) {}
+
+    temp_files(const temp_files&)            = delete;
+    temp_files& operator=(const temp_files&) = delete;
+
+    ~temp_files() {
+        for (const auto& path : paths_) {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+        }
+    }
+
+    /// Path of a new temporary file
+    std::string create() {
+        paths_.push_back((dir_ / (prefix_ + std::to_string(paths_.size()) + ".bin")).string());
+        return paths_.back();
+    }
+
+   private:
+    std::filesystem::path dir_;
+    std::string prefix_;
+    std::vector<std::string> paths_;
+};
+
+/** Sequential reader of a sorted run
+ *
+ * Holds the current block of the run while the next block is
+ * read in the background.
+ */
+template <typename T>
+class run_reader {
+   public:
+    run_reader(const std::string& path, const std::size_t block)
+        : file_(open_input(path)), block_(block), current_(block), next_(block) {
+        remaining_ = std::filesystem::file_size(path) / sizeof(T);
+        this->prefetch();
+        this->advance();
+    }
+
+    T* begin() noexcept { return current_.data() + first_; }
+
+    T* end() noexcept { return current_.data() + last_; }
+
+    std::size_t size() const noexcept { return last_ - first_; }
+
+    /// True if values remain beyond the current block
+    bool more() const noexcept { return pending_.valid(); }
+
+    void consume(const std::size_t n) noexcept { first_ += n; }
+
+    /// Replace the consumed block with the block read in the background
+    void advance() {
+        last_  = pending_.get();
+        first_ = 0;
+        std::swap(current_, next_);
+        if (remaining_ > 0) {
+            this->prefetch();
+        }
+    }
+
+   private:
+    std::ifstream file_;
+    std::size_t block_;
+    std::size_t remaining_ = 0;
+    std::size_t first_     = 0;
+    std::size_t last_      = 0;
+    uninitialized_vector<T> current_;
+    uninitialized_vector<T> next_;
+    std::future<std::size_t> pending_;
+
+    void prefetch() {
+        const auto n = std::min(block_, remaining_);
+        remaining_ -= n;
+        pending_ = std::async(std::launch::async, [this, n]() {
+            file_.read(reinterpret_cast<char*>(next_.data()), n * sizeof(T));
+            return n;
+        });
+    }
+};
+
+/** Sequential writer issuing one background write at a time
+ */
+template <typename T>
+class run_writer {
+   public:
+    explicit run_writer(const std::string& path) : file_(open_output(path)) {}
+
+    /// Write n values once the previous write finished (data must stay valid until then)
+    void write(const T* data, const std::size_t n) {
+        this->wait();
+        pending_ = std::async(std::launch::async, [this, data, n]() {
+            file_.write(reinterpret_cast<const char*>(data), n * sizeof(T));
+        });
+    }
+
+    void wait() {
+        if (pending_.valid()) {
+            pending_.get();
+        }
+    }
+
+    ~run_writer() {
+        if (pending_.valid()) {
+            pending_.wait();
+        }
+    }
+
+   private:
+    std::ofstream file_;
+    std::future<void> pending_;
+};
+
+/** Merge sorted segments [bounds[s], bounds[s+1]) in parallel
+ *
+ * Pairs of segments are merged in rounds alternating between
+ * the two buffers with every merge split along its merge path.
+ * The result ends in start after an even number of rounds and
+ * in other after an odd number (see merge_rounds).
+ */
+template <typename Policy, typename T, typename Compare>
+void merge_segments(Policy&& policy, T* start, T* other, const std::vector<std::ptrdiff_t>& bounds,
+                    std::vector<merge_task>& tasks, Compare comp) {
+    const std::ptrdiff_t nseg = bounds.size() - 1;
+    const std::ptrdiff_t n    = bounds.back();
+    const std::ptrdiff_t grain =
+        std::max<std::ptrdiff_t>(arena_min_grain, n / (4 * std::max(1U, std::thread::hardware_concurrency())));
+    auto bound = [&](std::ptrdiff_t s) { return bounds[std::min(s, nseg)]; };
+
+    for (std::ptrdiff_t width = 1; width < nseg; width *= 2) {
+        tasks.resize(n / grain + nseg + 1);
+        std::ptrdiff_t ntasks = 0;
+        for (std::ptrdiff_t s = 0; s < nseg; s += 2 * width) {
+            const auto lo  = bound(s);
+            const auto mid = bound(s + width);
+            const auto hi  = bound(s + 2 * width);
+            ntasks += add_merge_tasks(tasks.data() + ntasks, lo, mid - lo, mid, hi - mid, lo, grain);
+        }
+        run_merge_tasks(policy, tasks.data(), ntasks, start, start, other, comp);
+        std::swap(start, other);
+    }
+}
+
+/// Number of merge rounds for nseg segments
+inline std::size_t merge_rounds(std::size_t nseg) {
+    std::size_t rounds = 0;
+    for (std::size_t width = 1; width < nseg; width *= 2) {
+        ++rounds;
+    }
+    return rounds;
+}
+
+/** Merge sorted run files into one file within a memory budget
+ */
+template <typename T, typename Policy, typename Compare>
+void merge_runs(Policy&& policy, const std::vector<std::string>& runs, const std::string& output,
+                const std::size_t budget, Compare comp) {
+    const auto k     = runs.size();
+    const auto block = std::max<std::size_t>(budget / (external_blocks_per_run * k * sizeof(T)), 1);
+
+    std::vector<std::unique_ptr<run_reader<T>>> readers;
+    for (const auto& run : runs) {
+        readers.push_back(std::make_unique<run_reader<T>>(run, block));
+    }
+    uninitialized_vector<T> scratch(k * block);
+    uninitialized_vector<T> out[2] = {uninitialized_vector<T>(k * block), uninitialized_vector<T>(k * block)};
+    std::vector<std::ptrdiff_t> bounds(k + 1);
+    std::vector<merge_task> tasks;
+    run_writer<T> writer(output);
+
+    for (int ob = 0;; ob ^= 1) {
+        // Refill consumed blocks and find the smallest value not yet
+        // safe to output (the last buffered value of each run with more data)
+        const T* limit = nullptr;
+        for (auto& r : readers) {
+            if (r->size() == 0 and r->more()) {
+                r->advance();
+            }
+            if (r->more() and (limit == nullptr or comp(*(r->end() - 1), *limit))) {
+                limit = r->end() - 1;
+            }
+        }
+
+        // Length of each segment which can be output now
+        std::vector<std::size_t> cuts(k);
+        for (std::size_t r = 0; r < k; ++r) {
+            auto& reader = *readers[r];
+            if (limit == nullptr) {
+                cuts[r] = reader.size();
+            } else {
+                cuts[r] = std::upper_bound(reader.begin(), reader.end(), *limit, comp) - reader.begin();
+            }
+            bounds[r + 1] = bounds[r] + cuts[r];
+        }
+        if (bounds[k] == 0) {
+            break;
+        }
+
+        // Gather segments into the buffer the merge rounds start from
+        T* dest  = out[ob].data();
+        T* start = (merge_rounds(k) % 2 == 0) ? dest : scratch.data();
+        T* other = (start == dest) ? scratch.data() : dest;
+        for (std::size_t r = 0; r < k; ++r) {
+            std::copy(readers[r]->begin(), readers[r]->begin() + cuts[r], start + bounds[r]);
+            readers[r]->consume(cuts[r]);
+        }
+        merge_segments(policy, start, other, bounds, tasks, comp);
+        writer.write(dest, bounds[k]);
+    }
+    writer.wait();
+}
+
+} /* namespace detail */
+
+/** Sort a binary file of values larger than memory
+ *
+ * The input file holds the raw bytes of values of type T (as
+ * written by xstd::mmap_array).  Runs are read, sorted and
+ * written to temporary files while the next run is read and
+ * sorted.  Runs are sized so both run buffers and the sort's
+ * scratch fit the budget: half the budget each with sequenced
+ * policies (sorted in place) and about a third each with
+ * parallel policies (sorted by xstd::sort from an arena).  The
+ * runs are then merged with a parallel k-way merge: blocks of
+ * every run are read ahead in the background, all values not
+ * greater than the smallest last buffered value are merged in
+ * parallel by a tree of pairwise merges and written in the
+ * background while the next output block is merged.  The five
+ * blocks held per run fit the budget.  When there are too many
+ * runs for blocks of at least 1 MB within the budget, groups of
+ * runs are merged first in extra passes.  Small bookkeeping
+ * (stream buffers and merge task lists) is not counted.
+ *
+ * Temporary files are removed also when an exception is thrown.
+ *
+ * Failures to read or write throw std::ios_base::failure.
+ *
+ * \tparam T Type of value stored in the file (trivially copyable)
+ *
+ * \param policy[in] Execution policy used to sort and merge in memory
+ * \param input[in] Path of the unsorted file
+ * \param output[in] Path of the sorted file (may equal input)
+ * \param budget[in] Bytes of memory to use for buffers
+ * \param comp[in] Comparison function object
+ * \param temp_dir[in] Directory for the sorted runs (system temporary directory if empty)
+ */
+template <typename T, typename Policy, typename Compare = std::less<>,
+          detail::enable_if_execution_policy_t<Policy> = 0>
+void external_sort(Policy&& policy, const std::string& input, const std::string& output, const std::size_t budget,
+                   Compare comp = Compare(), const std::string& temp_dir = std::string()) {
+    static_assert(std::is_trivially_copyable_v<T>, "Sorted type must be trivially copyable");
+    namespace fs = std::filesystem;
+
+    const auto total    = fs::file_size(input) / sizeof(T);
+    const auto run_size = detail::external_run_size<T, Policy>(budget);
+
+    // Temporary run files with a unique prefix
+    const auto dir    = temp_dir.empty() ? fs::temp_directory_path() : fs::path(temp_dir);
+    const auto prefix = "xstd_external_sort_" + std::to_string(std::random_device()()) + "_";
+    detail::temp_files temps(dir, prefix);
+
+    // Sort runs using two buffers so a run is written while the next is read and sorted
+    std::vector<std::string> runs;
+    {
+        auto file = detail::open_input(input);
+        uninitialized_vector<T> buffer[2];
+        scratch_arena arena(detail::external_sort_scratch<T, Policy>(std::min(run_size, total)));
+        std::future<void> writing;
+        for (std::size_t offset = 0, r = 0; offset < total; offset += run_size, ++r) {
+            const auto n = std::min(run_size, total - offset);
+            auto& buf    = buffer[r % 2];
+            buf.resize(n);
+            file.read(reinterpret_cast<char*>(buf.data()), n * sizeof(T));
+            arena.reset();
+            xstd::sort(policy, buf.begin(), buf.end(), arena, comp);
+            if (writing.valid()) {
+                writing.get();
+            }
+            runs.push_back((total <= run_size) ? output : temps.create());
+            writing = std::async(std::launch::async, [data = buf.data(), n, path = runs.back()]() {
+                auto out = detail::open_output(path);
+                out.write(reinterpret_cast<const char*>(data), n * sizeof(T));
+            });
+        }
+        if (writing.valid()) {
+            writing.get();
+        }
+    }
+    if (total == 0) {
+        detail::open_output(output);
+    }
+    if (runs.size() < 2) {
+        return;
+    }
+
+    // Merge groups of runs until they fit a single pass
+    const auto fan_in =
+        std::max<std::size_t>(2, budget / (detail::external_blocks_per_run * detail::external_min_block));
+    while (runs.size() > fan_in) {
+        std::vector<std::string> merged;
+        for (std::size_t first = 0; first < runs.size(); first += fan_in) {
+            const auto last = std::min(first + fan_in, runs.size());
+            std::vector<std::string> group(runs.begin() + first, runs.begin() + last);
+            if (group.size() == 1) {
+                merged.push_back(group.front());
+                continue;
+            }
+            merged.push_back(temps.create());
+            detail::merge_runs<T>(policy, group, merged.back(), budget, comp);
+            for (const auto& run : group) {
+                fs::remove(run);
+            }
+        }
+        runs.swap(merged);
+    }
+    detail::merge_runs<T>(policy, runs, output, budget, comp);
+    for (const auto& run : runs) {
+        fs::remove(run);
+    }
+}
+
+/** Sort a binary file of values larger than memory under a traced region
+ *
+ * The region counts every value of the input file.
+ */
+template <typename T, typename Policy, typename Compare = std::less<>>
+void external_sort(const execution::traced_policy<Policy>& policy, const std::string& input,
+                   const std::string& output, const std::size_t budget, Compare comp = Compare(),
+                   const std::string& temp_dir = std::string()) {
+    const auto elements = static_cast<std::size_t>(std::filesystem::file_size(input) / sizeof(T));
+    detail::traced_call(policy, elements, [&](const Policy& p) {
+        xstd::external_sort<T>(p, input, output, budget, comp, temp_dir);
+    });
+}
+
+} /* namespace xstd */
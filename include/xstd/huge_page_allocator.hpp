@@ -0,0 +1,226 @@
+/**
+ * \file       huge_page_allocator.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>  // std::min, std::max
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uintptr_t
+#include <fstream>    // std::ifstream
+#include <limits>     // std::numeric_limits
+#include <new>        // std::bad_alloc, std::align_val_t
+#include <sstream>    // std::istringstream
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+#if defined(__linux__)
+#include <sys/mman.h>  // mmap, munmap, madvise
+#endif
+
+namespace xstd {
+namespace detail {
+
+/// Size of the huge pages requested (2 MB on x86-64 and aarch64)
+inline constexpr std::size_t huge_page_size = std::size_t(2) * 1024 * 1024;
+
+inline std::size_t round_up(const std::size_t bytes, const std::size_t multiple) {
+    return ((bytes + multiple - 1) / multiple) * multiple;
+}
+
+/** Map bytes (multiple of huge_page_size) backed by huge pages
+ *
+ * Tries an explicit hugetlbfs mapping first if requested and
+ * falls back to a 2 MB aligned anonymous mapping advised with
+ * MADV_HUGEPAGE for transparent huge pages.
+ */
+inline void* map_huge_pages(const std::size_t bytes, const bool try_hugetlb) {
+#if defined(__linux__)
+#if defined(MAP_HUGETLB)
+    if (try_hugetlb) {
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+        flags |= (21 << MAP_HUGE_SHIFT);  // log2(2 MB)
+#endif
+        void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (ptr != MAP_FAILED) {
+            return ptr;
+        }
+    }
+#endif
+    // Over allocate then trim so the region starts on a huge page boundary
+    const std::size_t length = bytes + huge_page_size;
+    void* base = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    const auto first   = reinterpret_cast<std::uintptr_t>(base);
+    const auto aligned = round_up(first, huge_page_size);
+    const auto head    = aligned - first;
+    const auto tail    = length - head - bytes;
+    if (head > 0) {
+        ::munmap(base, head);
+    }
+    if (tail > 0) {
+        ::munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+    }
+#if defined(MADV_HUGEPAGE)
+    ::madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(aligned);
+#else
+    (void)try_hugetlb;
+    return ::operator new(bytes, std::align_val_t(huge_page_size));
+#endif
+}
+
+/** Release a region returned by map_huge_pages
+ */
+inline void unmap_huge_pages(void* ptr, const std::size_t bytes) noexcept {
+#if defined(__linux__)
+    ::munmap(ptr, bytes);
+#else
+    (void)bytes;
+    ::operator delete(ptr, std::align_val_t(huge_page_size));
+#endif
+}
+
+} /* namespace detail */
+
+/** Allocator returning memory backed by 2 MB huge pages
+ *
+ * Every allocation is rounded up to a multiple of 2 MB and mapped
+ * on a 2 MB boundary so the kernel can back it with huge pages,
+ * reducing TLB misses and the number of first touch page faults
+ * for large arrays.  By default transparent huge pages are
+ * requested with madvise(MADV_HUGEPAGE).  Optionally explicit
+ * hugetlbfs pages (MAP_HUGETLB) are tried first with a fallback
+ * to transparent huge pages when none are reserved.
+ *
+ * Intended for large arrays since small allocations still
+ * consume a full 2 MB.  On systems other than Linux the memory
+ * is only aligned to 2 MB.
+ *
+ * \tparam T Type of value to allocate
+ *
+ * \code{.cpp}
+ * xstd::huge_page_vector<double> x(N);
+ * std::fill(std::execution::par, x.begin(), x.end(), 0.0);
+ * double backed = xstd::huge_page_fraction(x.data(), x.size() * sizeof(double));
+ * \endcode
+ */
+template <typename T>
+class huge_page_allocator {
+   public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    template <typename U>
+    struct rebind {
+        using other = huge_page_allocator<U>;
+    };
+
+    /** Construct allocator
+     *
+     * \param try_hugetlb[in] Try explicit hugetlbfs pages before transparent huge pages
+     */
+    explicit huge_page_allocator(const bool try_hugetlb = false) noexcept : try_hugetlb_(try_hugetlb) {}
+
+    template <typename U>
+    huge_page_allocator(const huge_page_allocator<U>& other) noexcept : try_hugetlb_(other.try_hugetlb()) {}
+
+    /** Returns true if explicit hugetlbfs pages are tried first
+     */
+    bool try_hugetlb() const noexcept { return try_hugetlb_; }
+
+    T* allocate(const std::size_t n) {
+        if (n > (std::numeric_limits<std::size_t>::max() - detail::huge_page_size) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        const auto bytes = detail::round_up(std::max<std::size_t>(n * sizeof(T), 1), detail::huge_page_size);
+        return static_cast<T*>(detail::map_huge_pages(bytes, try_hugetlb_));
+    }
+
+    void deallocate(T* ptr, const std::size_t n) noexcept {
+        const auto bytes = detail::round_up(std::max<std::size_t>(n * sizeof(T), 1), detail::huge_page_size);
+        detail::unmap_huge_pages(ptr, bytes);
+    }
+
+    friend bool operator==(const huge_page_allocator&, const huge_page_allocator&) noexcept { return true; }
+
+    friend bool operator!=(const huge_page_allocator&, const huge_page_allocator&) noexcept { return false; }
+
+   private:
+    bool try_hugetlb_;
+};
+
+/** std::vector using the huge_page_allocator
+ */
+template <typename T>
+using huge_page_vector = std::vector<T, huge_page_allocator<T>>;
+
+/** Fraction of a memory region backed by huge pages
+ *
+ * Reads /proc/self/smaps and sums the transparent (AnonHugePages)
+ * and hugetlbfs (Private_Hugetlb, Shared_Hugetlb) sizes of every
+ * mapping overlapping the region.  Mappings only partially covered
+ * by the region contribute in proportion to the overlap.  Pages
+ * only count once touched.  Returns 0 if the information is not
+ * available.
+ *
+ * \param ptr[in] Start of the memory region
+ * \param bytes[in] Size of the memory region in bytes
+ *
+ * \return Fraction between 0 and 1
+ */
+inline double huge_page_fraction(const void* ptr, const std::size_t bytes) {
+    if (bytes == 0) {
+        return 0;
+    }
+    std::ifstream smaps("/proc/self/smaps");
+    if (not smaps) {
+        return 0;
+    }
+
+    const auto first = reinterpret_cast<std::uintptr_t>(ptr);
+    const auto last  = first + bytes;
+
+    double huge_bytes    = 0;
+    std::uintptr_t start = 0;
+    std::uintptr_t stop  = 0;
+    double vma_huge      = 0;
+
+    auto accumulate = [&]() {
+        const auto lo = std::max(start, first);
+        const auto hi = std::min(stop, last);
+        if (hi > lo and stop > start) {
+            huge_bytes += vma_huge * double(hi - lo) / double(stop - start);
+        }
+        vma_huge = 0;
+    };
+
+    std::string line;
+    while (std::getline(smaps, line)) {
+        const auto dash = line.find('-');
+        const auto key  = line.find(':');
+        if (dash != std::string::npos and (key == std::string::npos or dash < key)) {
+            // Header line of a new mapping "start-end perms ..."
+            accumulate();
+            start = std::stoull(line.substr(0, dash), nullptr, 16);
+            stop  = std::stoull(line.substr(dash + 1), nullptr, 16);
+        } else if (key != std::string::npos) {
+            const auto name = line.substr(0, key);
+            if (name == "AnonHugePages" or name == "Private_Hugetlb" or name == "Shared_Hugetlb") {
+                std::istringstream value(line.substr(key + 1));
+                double kb = 0;
+                value >> kb;
+                vma_huge += kb * 1024;
+            }
+        }
+    }
+    accumulate();
+    return std::min(1.0, huge_bytes / double(bytes));
+}
+
+} /* namespace xstd */
@@ -0,0 +1,277 @@
+/**
+ * \file       mmap_array.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>     // std::for_each
+#include <cerrno>        // errno
+#include <cstddef>       // std::size_t, std::ptrdiff_t
+#include <string>        // std::string
+#include <system_error>  // std::system_error
+#include <type_traits>   // std::remove_const_t, std::is_const_v, std::is_trivially_copyable_v
+#include <utility>       // std::exchange, std::swap
+
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap, madvise, msync
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close, ftruncate, sysconf
+
+#include "xstd/range.hpp"
+
+namespace xstd {
+
+/** Access pattern hint passed to the kernel for a mapping
+ */
+enum class map_advice {
+    normal,      ///< Default read ahead
+    sequential,  ///< Aggressive read ahead and early release of pages behind
+    random,      ///< No read ahead
+    willneed     ///< Start reading the whole mapping in the background
+};
+
+/** When the pages of a mapping are read
+ *
+ * An enum rather than a bool so a size passed to the creating
+ * constructor can never be taken for the flag of the opening one.
+ */
+enum class map_load {
+    lazy,     ///< Read each page the first time it is touched
+    populate  ///< Read the whole mapping while mapping (MAP_POPULATE)
+};
+
+/** Array of values stored in a memory-mapped file
+ *
+ * The file contents are the raw bytes of the values so the
+ * array exposes contiguous pointers usable directly as random
+ * access iterators by the std:: algorithms and xstd adaptors
+ * without first copying the file into memory.  Pages are read
+ * from the file (or page cache) the first time they are touched.
+ *
+ * mmap_array<const T> maps an existing file read-only.
+ * mmap_array<T> maps a file read-write creating or resizing it
+ * when a size is given.  Changes are written back to the file.
+ *
+ * Failures to open or map the file throw std::system_error.
+ *
+ * \tparam T Type of value stored (const for read-only)
+ *
+ * \code{.cpp}
+ * xstd::mmap_array<const double> field("field.bin");
+ * field.advise(xstd::map_advice::sequential);
+ * field.prefault(std::execution::par);
+ * auto sum = std::reduce(std::execution::par, field.begin(), field.end());
+ * \endcode
+ */
+template <typename T>
+class mmap_array {
+    static_assert(std::is_trivially_copyable_v<std::remove_const_t<T>>, "Mapped type must be trivially copyable");
+
+   public:
+    using element_type    = T;
+    using value_type      = std::remove_const_t<T>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = T*;
+    using reference       = T&;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    static constexpr bool read_only = std::is_const_v<T>;
+
+    mmap_array() = default;
+
+    /** Map an existing file
+     *
+     * The size is the file size divided by sizeof(T).
+     *
+     * \param path[in] Path of the file
+     * \param load[in] Read pages when touched or the whole file while mapping
+     */
+    explicit mmap_array(const std::string& path, const map_load load = map_load::lazy) {
+        this->open_file(path, read_only ? O_RDONLY : O_RDWR);
+        struct stat info;
+        if (::fstat(fd_, &info) != 0) {
+            this->fail("fstat " + path);
+        }
+        size_ = static_cast<std::size_t>(info.st_size) / sizeof(T);
+        this->map_file(path, load == map_load::populate);
+    }
+
+    /** Map a file holding n values creating or resizing it
+     *
+     * Only available for read-write arrays.
+     *
+     * \param path[in] Path of the file
+     * \param n[in] Number of values
+     * \param load[in] Fault in pages when touched or the whole mapping while mapping
+     */
+    template <bool RO = read_only, typename = std::enable_if_t<not RO>>
+    mmap_array(const std::string& path, const size_type n, const map_load load = map_load::lazy) {
+        this->open_file(path, O_RDWR | O_CREAT);
+        if (::ftruncate(fd_, static_cast<off_t>(n * sizeof(T))) != 0) {
+            this->fail("ftruncate " + path);
+        }
+        size_ = n;
+        this->map_file(path, load == map_load::populate);
+    }
+
+    mmap_array(const mmap_array&) = delete;
+
+    mmap_array& operator=(const mmap_array&) = delete;
+
+    mmap_array(mmap_array&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          fd_(std::exchange(other.fd_, -1)) {}
+
+    mmap_array& operator=(mmap_array&& other) noexcept {
+        mmap_array(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~mmap_array() { this->close(); }
+
+    void swap(mmap_array& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(fd_, other.fd_);
+    }
+
+    // ====================================================
+    // Access
+    // ====================================================
+
+    T* data() const noexcept { return data_; }
+
+    size_type size() const noexcept { return size_; }
+
+    size_type bytes() const noexcept { return size_ * sizeof(T); }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    T* begin() const noexcept { return data_; }
+
+    T* end() const noexcept { return data_ + size_; }
+
+    const T* cbegin() const noexcept { return data_; }
+
+    const T* cend() const noexcept { return data_ + size_; }
+
+    T& operator[](const size_type i) const noexcept { return data_[i]; }
+
+    // ====================================================
+    // Paging
+    // ====================================================
+
+    /** Tell the kernel how the array will be accessed
+     */
+    void advise(const map_advice advice) const {
+        if (this->empty()) {
+            return;
+        }
+        int flag = MADV_NORMAL;
+        switch (advice) {
+            case map_advice::normal:
+                flag = MADV_NORMAL;
+                break;
+            case map_advice::sequential:
+                flag = MADV_SEQUENTIAL;
+                break;
+            case map_advice::random:
+                flag = MADV_RANDOM;
+                break;
+            case map_advice::willneed:
+                flag = MADV_WILLNEED;
+                break;
+        }
+        if (::madvise(const_cast<value_type*>(data_), this->bytes(), flag) != 0) {
+            throw std::system_error(errno, std::generic_category(), "madvise");
+        }
+    }
+
+    /** Touch every page using policy
+     *
+     * Reads one byte of every page so the page faults (and any
+     * file reads) are spread over the threads of the policy
+     * instead of happening inside a later timed computation.
+     */
+    template <typename Policy>
+    void prefault(Policy&& policy) const {
+        const auto page  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const auto pages = (this->bytes() + page - 1) / page;
+        auto first       = reinterpret_cast<const volatile char*>(data_);
+        auto indices     = xstd::range(pages);
+        std::for_each(policy, indices.begin(), indices.end(), [first, page](auto p) { (void)first[p * page]; });
+    }
+
+    /** Write modified pages back to the file
+     */
+    template <bool RO = read_only, typename = std::enable_if_t<not RO>>
+    void sync() const {
+        if (not this->empty() and ::msync(data_, this->bytes(), MS_SYNC) != 0) {
+            throw std::system_error(errno, std::generic_category(), "msync");
+        }
+    }
+
+    /** Unmap the file
+     */
+    void close() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<value_type*>(data_), this->bytes());
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+        fd_   = -1;
+    }
+
+   private:
+    T* data_        = nullptr;
+    size_type size_ = 0;
+    int fd_         = -1;  // Only open while mapping
+
+    [[noreturn]] void fail(const std::string& what) {
+        const int error = errno;
+        this->close();
+        throw std::system_error(error, std::generic_category(), what);
+    }
+
+    void open_file(const std::string& path, const int flags) {
+        fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if (fd_ < 0) {
+            this->fail("open " + path);
+        }
+    }
+
+    void map_file(const std::string& path, const bool populate) {
+        if (size_ == 0) {
+            this->close();
+            return;
+        }
+        int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+        if (populate) {
+            flags |= MAP_POPULATE;
+        }
+#else
+        (void)populate;
+#endif
+        const int prot = read_only ? PROT_READ : (PROT_READ | PROT_WRITE);
+        void* ptr      = ::mmap(nullptr, this->bytes(), prot, flags, fd_, 0);
+        if (ptr == MAP_FAILED) {
+            size_ = 0;
+            this->fail("mmap " + path);
+        }
+        data_ = static_cast<T*>(ptr);
+
+        // Mapping remains valid after the file is closed
+        ::close(fd_);
+        fd_ = -1;
+    }
+};
+
+} /* namespace xstd */
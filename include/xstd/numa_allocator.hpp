@@ -0,0 +1,357 @@
+/**
+ * \file       numa_allocator.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>     // std::max, std::min
+#include <cerrno>        // errno
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uintptr_t
+#include <fstream>       // std::ifstream
+#include <limits>        // std::numeric_limits
+#include <map>           // std::map
+#include <new>           // std::bad_alloc, std::bad_array_new_length, std::align_val_t
+#include <string>        // std::string, std::getline
+#include <system_error>  // std::system_error
+#include <vector>        // std::vector
+
+#if defined(__linux__)
+#include <sys/mman.h>     // mmap, munmap
+#include <sys/syscall.h>  // SYS_mbind, SYS_set_mempolicy, SYS_move_pages
+#include <unistd.h>       // syscall, sysconf
+#endif
+
+namespace xstd {
+
+/** Placement of the pages of a NUMA allocation
+ */
+enum class numa_policy {
+    local,       ///< Pages placed on the node of the thread first touching them (or a given node)
+    interleave,  ///< Pages placed round-robin across all nodes
+    block        ///< Array split into one contiguous block per node matching a static partition
+};
+
+namespace detail {
+
+// Values from <linux/mempolicy.h> so libnuma headers are not required
+inline constexpr int mpol_default    = 0;
+inline constexpr int mpol_preferred  = 1;
+inline constexpr int mpol_bind       = 2;
+inline constexpr int mpol_interleave = 3;
+
+/** Nodes listed in /sys/devices/system/node/online
+ *
+ * Parses the kernel list format (ex. "0-3,6") and returns
+ * a single node 0 if the information is not available.
+ */
+inline std::vector<int> read_numa_nodes() {
+    std::vector<int> nodes;
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string entry;
+    while (std::getline(online, entry, ',')) {
+        const auto dash  = entry.find('-');
+        const int first  = std::stoi(entry.substr(0, dash));
+        const int last   = (dash == std::string::npos) ? first : std::stoi(entry.substr(dash + 1));
+        for (int n = first; n <= last; ++n) {
+            nodes.push_back(n);
+        }
+    }
+    if (nodes.empty()) {
+        nodes.push_back(0);
+    }
+    return nodes;
+}
+
+/** Bit mask of nodes in the layout expected by mbind/set_mempolicy
+ */
+struct node_mask {
+    static constexpr std::size_t bits = std::numeric_limits<unsigned long>::digits;
+
+    explicit node_mask(const std::vector<int>& nodes) {
+        const int max_node = *std::max_element(nodes.begin(), nodes.end());
+        words.resize(max_node / bits + 1, 0);
+        for (auto n : nodes) {
+            words[n / bits] |= (1UL << (n % bits));
+        }
+    }
+
+    const unsigned long* data() const noexcept { return words.data(); }
+
+    /// Number of bits passed as maxnode (the kernel ignores the last bit)
+    unsigned long max_node() const noexcept { return words.size() * bits + 1; }
+
+    std::vector<unsigned long> words;
+};
+
+inline std::size_t page_size() {
+#if defined(__linux__)
+    static const std::size_t size = ::sysconf(_SC_PAGESIZE);
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+#if defined(__linux__)
+inline void mbind_or_throw(void* ptr, const std::size_t bytes, const int mode, const std::vector<int>& nodes) {
+    if (bytes == 0) {
+        return;
+    }
+    long ierr = 0;
+    if (nodes.empty()) {
+        ierr = ::syscall(SYS_mbind, ptr, bytes, mode, nullptr, 0UL, 0U);
+    } else {
+        node_mask mask(nodes);
+        ierr = ::syscall(SYS_mbind, ptr, bytes, mode, mask.data(), mask.max_node(), 0U);
+    }
+    if (ierr != 0) {
+        throw std::system_error(errno, std::generic_category(), "mbind");
+    }
+}
+#endif
+
+} /* namespace detail */
+
+/** NUMA nodes online on this machine
+ */
+inline const std::vector<int>& numa_nodes() {
+    static const std::vector<int> nodes = detail::read_numa_nodes();
+    return nodes;
+}
+
+/** Number of NUMA nodes online on this machine
+ */
+inline std::size_t numa_node_count() { return numa_nodes().size(); }
+
+/** Allocator placing pages on NUMA nodes by policy
+ *
+ * Memory is mapped directly and bound with the mbind system
+ * call so libnuma is not required.  Pages are only placed
+ * once touched so with numa_policy::local the thread writing
+ * an element first decides where it lives (see
+ * xstd::uninitialized_fill to combine it with a parallel first
+ * touch).  With numa_policy::block the allocation is split into
+ * one contiguous block per node in the same way a static
+ * partition of the range divides the elements between threads.
+ *
+ * On single node machines (and systems other than Linux) no
+ * policy is applied and the allocator behaves like a page
+ * aligned std::allocator.
+ *
+ * \tparam T Type of value to allocate
+ *
+ * \code{.cpp}
+ * xstd::numa_vector<double> x(N, 0.0, xstd::numa_allocator<double>(xstd::numa_policy::interleave));
+ * auto histogram = xstd::numa_node_histogram(x.data(), x.size() * sizeof(double));
+ * \endcode
+ */
+template <typename T>
+class numa_allocator {
+   public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    template <typename U>
+    struct rebind {
+        using other = numa_allocator<U>;
+    };
+
+    /** Construct allocator
+     *
+     * \param policy[in] Placement of pages
+     * \param node[in] Node for numa_policy::local (negative for the first touching thread)
+     */
+    explicit numa_allocator(const numa_policy policy = numa_policy::local, const int node = -1) noexcept
+        : policy_(policy), node_(node) {}
+
+    template <typename U>
+    numa_allocator(const numa_allocator<U>& other) noexcept : policy_(other.policy()), node_(other.node()) {}
+
+    numa_policy policy() const noexcept { return policy_; }
+
+    int node() const noexcept { return node_; }
+
+    T* allocate(const std::size_t n) {
+        if (n > (std::numeric_limits<std::size_t>::max() - detail::page_size()) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        const auto bytes = this->mapped_bytes(n);
+#if defined(__linux__)
+        void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        try {
+            this->place(ptr, n);
+        } catch (...) {
+            ::munmap(ptr, bytes);
+            throw;
+        }
+        return static_cast<T*>(ptr);
+#else
+        return static_cast<T*>(::operator new(bytes, std::align_val_t(detail::page_size())));
+#endif
+    }
+
+    void deallocate(T* ptr, const std::size_t n) noexcept {
+#if defined(__linux__)
+        ::munmap(ptr, this->mapped_bytes(n));
+#else
+        (void)n;
+        ::operator delete(ptr, std::align_val_t(detail::page_size()));
+#endif
+    }
+
+    friend bool operator==(const numa_allocator&, const numa_allocator&) noexcept { return true; }
+
+    friend bool operator!=(const numa_allocator&, const numa_allocator&) noexcept { return false; }
+
+   private:
+    numa_policy policy_;
+    int node_;
+
+    static std::size_t mapped_bytes(const std::size_t n) {
+        const auto page = detail::page_size();
+        return ((std::max<std::size_t>(n * sizeof(T), 1) + page - 1) / page) * page;
+    }
+
+#if defined(__linux__)
+    void place(void* ptr, const std::size_t n) const {
+        const auto& nodes = numa_nodes();
+        if (nodes.size() < 2) {
+            return;
+        }
+        const auto bytes = mapped_bytes(n);
+        switch (policy_) {
+            case numa_policy::local:
+                if (node_ < 0) {
+                    detail::mbind_or_throw(ptr, bytes, detail::mpol_preferred, {});  // Empty mask = local
+                } else {
+                    detail::mbind_or_throw(ptr, bytes, detail::mpol_bind, {node_});
+                }
+                break;
+            case numa_policy::interleave:
+                detail::mbind_or_throw(ptr, bytes, detail::mpol_interleave, nodes);
+                break;
+            case numa_policy::block: {
+                // Block b holds elements [b*n/nb, (b+1)*n/nb) rounded to pages
+                const auto page  = detail::page_size();
+                const auto nb    = nodes.size();
+                auto base        = static_cast<char*>(ptr);
+                std::size_t prev = 0;
+                for (std::size_t b = 0; b < nb; ++b) {
+                    const std::size_t last = (b + 1 == nb) ? bytes : (((b + 1) * n / nb) * sizeof(T) / page) * page;
+                    if (last > prev) {
+                        detail::mbind_or_throw(base + prev, last - prev, detail::mpol_bind, {nodes[b]});
+                        prev = last;
+                    }
+                }
+                break;
+            }
+        }
+    }
+#endif
+};
+
+/** std::vector using the numa_allocator
+ */
+template <typename T>
+using numa_vector = std::vector<T, numa_allocator<T>>;
+
+/** Set the NUMA policy of the calling thread within a scope
+ *
+ * Applies to every allocation the calling thread faults in
+ * afterwards (ex. std::vector) and restores the default
+ * policy on destruction.  A no-op on single node machines.
+ */
+class scoped_numa_policy {
+   public:
+    explicit scoped_numa_policy(const numa_policy policy, const int node = -1) {
+#if defined(__linux__)
+        const auto& nodes = numa_nodes();
+        if (nodes.size() < 2) {
+            return;
+        }
+        long ierr = 0;
+        if (policy == numa_policy::local and node < 0) {
+            ierr = ::syscall(SYS_set_mempolicy, detail::mpol_preferred, nullptr, 0UL);
+        } else {
+            const int mode = (policy == numa_policy::local) ? detail::mpol_bind : detail::mpol_interleave;
+            detail::node_mask mask(policy == numa_policy::local ? std::vector<int>{node} : nodes);
+            ierr = ::syscall(SYS_set_mempolicy, mode, mask.data(), mask.max_node());
+        }
+        if (ierr != 0) {
+            throw std::system_error(errno, std::generic_category(), "set_mempolicy");
+        }
+        active_ = true;
+#else
+        (void)policy;
+        (void)node;
+#endif
+    }
+
+    scoped_numa_policy(const scoped_numa_policy&) = delete;
+
+    scoped_numa_policy& operator=(const scoped_numa_policy&) = delete;
+
+    ~scoped_numa_policy() {
+#if defined(__linux__)
+        if (active_) {
+            ::syscall(SYS_set_mempolicy, detail::mpol_default, nullptr, 0UL);
+        }
+#endif
+    }
+
+   private:
+    bool active_ = false;
+};
+
+/** Node of every page in a memory region
+ *
+ * Queries the placement with the move_pages system call
+ * without moving anything.  Pages which are not yet touched
+ * report a negative errno (ex. -ENOENT).  Returns all zeros
+ * on single node machines.
+ *
+ * \param ptr[in] Start of the memory region
+ * \param bytes[in] Size of the memory region in bytes
+ *
+ * \return Node of each page
+ */
+inline std::vector<int> numa_page_nodes(const void* ptr, const std::size_t bytes) {
+    const auto page  = detail::page_size();
+    const auto first = reinterpret_cast<std::uintptr_t>(ptr) / page * page;
+    const auto last  = reinterpret_cast<std::uintptr_t>(ptr) + bytes;
+    const auto count = (bytes == 0) ? 0 : (last - first + page - 1) / page;
+
+    std::vector<int> status(count, 0);
+#if defined(__linux__)
+    if (numa_node_count() < 2 or count == 0) {
+        return status;
+    }
+    std::vector<void*> pages(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        pages[i] = reinterpret_cast<void*>(first + i * page);
+    }
+    if (::syscall(SYS_move_pages, 0, count, pages.data(), nullptr, status.data(), 0) != 0) {
+        throw std::system_error(errno, std::generic_category(), "move_pages");
+    }
+#endif
+    return status;
+}
+
+/** Number of pages of a memory region on each node
+ *
+ * Pages not yet touched are counted under their negative errno.
+ */
+inline std::map<int, std::size_t> numa_node_histogram(const void* ptr, const std::size_t bytes) {
+    std::map<int, std::size_t> histogram;
+    for (auto node : numa_page_nodes(ptr, bytes)) {
+        ++histogram[node];
+    }
+    return histogram;
+}
+
+} /* namespace xstd */
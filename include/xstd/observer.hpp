@@ -0,0 +1,459 @@
+/**
+ * \file       observer.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::max, std::min
+#include <atomic>       // std::atomic
+#include <chrono>       // std::chrono::duration_cast
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <map>          // std::map
+#include <memory>       // std::unique_ptr
+#include <mutex>        // std::mutex, std::lock_guard
+#include <set>          // std::set
+#include <thread>       // std::thread::id, std::this_thread
+#include <type_traits>  // std::decay_t
+#include <utility>      // std::forward, std::move
+
+#if __has_include(<tbb/task_scheduler_observer.h>)
+#include <tbb/task_scheduler_observer.h>
+#define XSTD_OBSERVER_TBB 1
+#else
+#define XSTD_OBSERVER_TBB 0
+#endif
+
+#include "xstd/stop_watch.hpp"
+
+namespace xstd {
+
+class parallelism_observer;
+
+namespace detail {
+
+/// Observer recording the calls of observed functions (if any)
+inline std::atomic<parallelism_observer*> active_observer{nullptr};
+
+/// Unique id of each observer so stale thread caches are detected
+inline std::uint64_t next_observer_id() noexcept {
+    static std::atomic<std::uint64_t> id{0};
+    return ++id;
+}
+
+/** Time spent between two timed calls by the timing itself
+ *
+ * Each timed call reads the clock before and after the call so
+ * the instrumentation between the end of one call and the start
+ * of the next is not busy time.  Measured once by timing back to
+ * back empty calls so it can be taken out of the idle time.
+ */
+inline double call_overhead_seconds() {
+    static const double overhead = []() {
+        using clock             = maxres_nonsleep_clock;
+        constexpr std::size_t N = 10000;
+        auto busy               = clock::duration::zero();
+        const auto first        = clock::now();
+        for (std::size_t i = 0; i < N; ++i) {
+            const auto start = clock::now();
+            busy += clock::now() - start;
+        }
+        const auto outside = (clock::now() - first) - busy;
+        return std::chrono::duration_cast<std::chrono::duration<double>>(outside).count() / N;
+    }();
+    return overhead;
+}
+
+} /* namespace detail */
+
+/** Record which threads run the elements of parallel algorithms
+ *
+ * While started every call to a function wrapped by xstd::observe
+ * is counted against the calling thread.  After the algorithm
+ * returns the number of distinct threads and elements per thread
+ * show if a call actually ran in parallel or silently fell back
+ * to one thread (iterator category, missing backend, etc.).
+ *
+ * Only one observer is active at a time.  Starting an observer
+ * while another is active suspends the other until it stops.
+ * Nested observers are meant to be stopped in reverse order of
+ * starting (LIFO).  An observer stopped out of order is only
+ * removed from the chain, the active observer keeps recording.
+ *
+ * When constructed to time calls the time spent inside each
+ * observed call is also added to the busy time of its thread.
+ * Comparing the busy times with the wall time between start and
+ * stop shows the load balance of the call: a single thread
+ * finishing late makes the whole call slow while the others
+ * sit idle.  Timing every call costs two clock reads per call
+ * so it is meant for untimed diagnostic runs.
+ *
+ * \code{.cpp}
+ * xstd::parallelism_observer observer;
+ * observer.start();
+ * std::for_each(std::execution::par, x.begin(), x.end(), xstd::observe([](auto& v) { v *= 2; }));
+ * observer.stop();
+ * std::cout << observer.threads() << std::endl;
+ * \endcode
+ */
+class parallelism_observer final {
+   public:
+    using clock = detail::maxres_nonsleep_clock;
+
+    /// Observed calls and time spent in them by one thread
+    struct thread_record {
+        std::size_t elements = 0;
+        clock::duration busy = clock::duration::zero();
+    };
+
+    using record_map = std::map<std::thread::id, thread_record>;
+
+    parallelism_observer() = default;
+
+    explicit parallelism_observer(const bool time_calls) : time_calls_(time_calls) {}
+
+    parallelism_observer(const parallelism_observer&)            = delete;
+    parallelism_observer& operator=(const parallelism_observer&) = delete;
+
+    ~parallelism_observer() { this->stop(); }
+
+    /** Return status of observer
+     */
+    bool is_running() const noexcept { return is_running_; }
+
+    /** Return if the time inside observed calls is measured
+     */
+    bool times_calls() const noexcept { return time_calls_; }
+
+    /** Start recording observed calls (keeps current records)
+     */
+    void start() noexcept {
+        if (not this->is_running()) {
+            if (time_calls_) {
+                detail::call_overhead_seconds();  // Calibrate before the clock starts
+            }
+            previous_   = detail::active_observer.exchange(this, std::memory_order_acq_rel);
+            is_running_ = true;
+            watch_.start();
+        }
+    }
+
+    /** Stop recording observed calls
+     */
+    void stop() noexcept {
+        if (this->is_running()) {
+            watch_.stop();
+            auto expected = this;
+            if (not detail::active_observer.compare_exchange_strong(expected, previous_, std::memory_order_acq_rel)) {
+                // Stopped out of order: unlink from the observers started after this one
+                for (auto later = expected; later != nullptr; later = later->previous_) {
+                    if (later->previous_ == this) {
+                        later->previous_ = previous_;
+                        break;
+                    }
+                }
+            }
+            previous_   = nullptr;
+            is_running_ = false;
+        }
+    }
+
+    /** Stop and clear all records
+     */
+    void reset() {
+        this->stop();
+        std::lock_guard<std::mutex> lock(mutex_);
+        records_.clear();
+        watch_.reset();
+        id_ = detail::next_observer_id();
+    }
+
+    /** Number of distinct threads which made observed calls
+     */
+    std::size_t threads() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return records_.size();
+    }
+
+    /** Wall time between start and stop
+     */
+    double wall_seconds() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return watch_.elapsed_seconds();
+    }
+
+    /** Total number of observed calls
+     */
+    std::size_t elements() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t total = 0;
+        for (const auto& [id, record] : records_) {
+            total += record.elements;
+        }
+        return total;
+    }
+
+    /** Fewest observed calls made by any one thread (0 if none)
+     */
+    std::size_t min_elements() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t result = records_.empty() ? 0 : records_.begin()->second.elements;
+        for (const auto& [id, record] : records_) {
+            result = std::min(result, record.elements);
+        }
+        return result;
+    }
+
+    /** Most observed calls made by any one thread
+     */
+    std::size_t max_elements() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t result = 0;
+        for (const auto& [id, record] : records_) {
+            result = std::max(result, record.elements);
+        }
+        return result;
+    }
+
+    /** Longest time one thread spent inside observed calls
+     */
+    double busy_max_seconds() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto result = clock::duration::zero();
+        for (const auto& [id, record] : records_) {
+            result = std::max(result, record.busy);
+        }
+        return to_seconds_(result);
+    }
+
+    /** Mean time the threads spent inside observed calls
+     */
+    double busy_mean_seconds() const {
+        const auto n = this->threads();
+        return (n == 0) ? 0 : this->busy_total_seconds_() / n;
+    }
+
+    /** Ratio of the longest to the mean busy time (1 is balanced)
+     */
+    double imbalance() const {
+        const auto mean = this->busy_mean_seconds();
+        return (mean > 0) ? this->busy_max_seconds() / mean : 1;
+    }
+
+    /** Time the threads spent outside observed calls
+     *
+     * Wall time times the number of threads less the total busy
+     * time and the estimated cost of timing the calls.  Includes
+     * scheduling, the algorithm's own loop, waiting for work and
+     * waiting for the slowest thread to finish.
+     */
+    double idle_seconds() const {
+        const double timing = time_calls_ ? this->elements() * detail::call_overhead_seconds() : 0.0;
+        const double idle   = this->wall_seconds() * this->threads() - this->busy_total_seconds_() - timing;
+        return std::max(idle, 0.0);
+    }
+
+    /** Copy of observed calls and busy time per thread
+     */
+    record_map records() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return records_;
+    }
+
+    /** Count one call (taking busy time) from the calling thread
+     *
+     * The lock is only taken the first time a thread calls in so
+     * later calls just update the thread's own record.  Records
+     * are read after the algorithm returns which orders them
+     * after the updates of the worker threads.
+     */
+    void record(const clock::duration busy = clock::duration::zero()) {
+        struct cache_type {
+            std::uint64_t id      = 0;
+            thread_record* record = nullptr;
+        };
+        thread_local cache_type cache;
+        if (cache.id != id_) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cache.record = &records_[std::this_thread::get_id()];
+            cache.id     = id_;
+        }
+        ++(cache.record->elements);
+        cache.record->busy += busy;
+    }
+
+   private:
+    mutable std::mutex mutex_;
+    mutable StopWatch watch_;
+    record_map records_;
+    parallelism_observer* previous_ = nullptr;
+    std::uint64_t id_               = detail::next_observer_id();
+    bool is_running_                = false;
+    bool time_calls_                = false;
+
+    static double to_seconds_(const clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+    }
+
+    double busy_total_seconds_() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto total = clock::duration::zero();
+        for (const auto& [id, record] : records_) {
+            total += record.busy;
+        }
+        return to_seconds_(total);
+    }
+};
+
+namespace detail {
+
+/** Record one observed call with the active observer
+ *
+ * Constructed before the call and destroyed after it so the
+ * busy time also covers calls which return values.
+ */
+class call_recorder {
+    using clock = parallelism_observer::clock;
+
+   public:
+    call_recorder() noexcept : observer_(active_observer.load(std::memory_order_acquire)) {
+        if (observer_ and observer_->times_calls()) {
+            start_ = clock::now();
+        }
+    }
+
+    ~call_recorder() {
+        if (observer_) {
+            observer_->record(observer_->times_calls() ? clock::now() - start_ : clock::duration::zero());
+        }
+    }
+
+   private:
+    parallelism_observer* observer_;
+    clock::time_point start_;
+};
+
+} /* namespace detail */
+
+/** Function object counting its calls with the active observer
+ *
+ * Returned by xstd::observe.  Calls are forwarded unchanged so
+ * the wrapped function can be used with any algorithm.
+ */
+template <typename Function>
+class observed_function {
+   public:
+    explicit observed_function(Function function) : function_(std::move(function)) {}
+
+    template <typename... Args>
+    decltype(auto) operator()(Args&&... args) {
+        detail::call_recorder recorder;
+        return function_(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    decltype(auto) operator()(Args&&... args) const {
+        detail::call_recorder recorder;
+        return function_(std::forward<Args>(args)...);
+    }
+
+   private:
+    Function function_;
+};
+
+/** Record the threads of the parallel backend taking part in calls
+ *
+ * Counts the calling thread and, with TBB, every thread joining
+ * the task scheduler while started.  Nothing needs to be wrapped
+ * so the calls observed run exactly as they do untimed, at the
+ * cost of one lock per thread joining.  It cannot tell how much
+ * work each thread did (see parallelism_observer for that).
+ * Without TBB the algorithms run on the calling thread alone.
+ *
+ * \code{.cpp}
+ * xstd::scheduler_observer observer;
+ * observer.start();
+ * std::sort(std::execution::par, x.begin(), x.end());
+ * observer.stop();
+ * std::cout << observer.threads() << std::endl;
+ * \endcode
+ */
+class scheduler_observer final {
+   public:
+    scheduler_observer() = default;
+
+    scheduler_observer(const scheduler_observer&)            = delete;
+    scheduler_observer& operator=(const scheduler_observer&) = delete;
+
+    ~scheduler_observer() { this->stop(); }
+
+    /** Start recording threads (keeps current records)
+     */
+    void start() {
+        this->enter_();
+#if XSTD_OBSERVER_TBB
+        if (not entries_) {
+            entries_ = std::make_unique<entries_type>(*this);
+        }
+#endif
+    }
+
+    /** Stop recording threads
+     */
+    void stop() noexcept {
+#if XSTD_OBSERVER_TBB
+        entries_.reset();
+#endif
+    }
+
+    /** Stop and clear all records
+     */
+    void reset() {
+        this->stop();
+        std::lock_guard<std::mutex> lock(mutex_);
+        ids_.clear();
+    }
+
+    /** Number of distinct threads taking part
+     */
+    std::size_t threads() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ids_.size();
+    }
+
+   private:
+    mutable std::mutex mutex_;
+    std::set<std::thread::id> ids_;
+
+    void enter_() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ids_.insert(std::this_thread::get_id());
+    }
+
+#if XSTD_OBSERVER_TBB
+    // Observing while constructed (threads already in the arena are notified too)
+    struct entries_type final : tbb::task_scheduler_observer {
+        scheduler_observer& owner;
+
+        explicit entries_type(scheduler_observer& o) : owner(o) { this->observe(true); }
+        ~entries_type() { this->observe(false); }
+
+        void on_scheduler_entry(bool) override { owner.enter_(); }
+    };
+    std::unique_ptr<entries_type> entries_;
+#endif
+};
+
+/** Wrap a function so its calls are counted by the active observer
+ *
+ * Without an active observer the only cost is one atomic load
+ * per call.  The check does stop loops from vectorizing so
+ * observe diagnostic runs and not the kernels being tuned.
+ */
+template <typename Function>
+observed_function<std::decay_t<Function>> observe(Function&& function) {
+    return observed_function<std::decay_t<Function>>(std::forward<Function>(function));
+}
+
+} /* namespace xstd */
@@ -0,0 +1,253 @@
+/**
+ * \file       per_thread.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::max
+#include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <cstddef>      // std::size_t
+#include <functional>   // std::function
+#include <mutex>        // std::mutex, std::lock_guard
+#include <new>          // placement new, std::launder
+#include <type_traits>  // std::enable_if_t, std::is_invocable_r_v
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+namespace xstd {
+namespace detail {
+
+/// Size of a cache line (the unit of false sharing)
+inline constexpr std::size_t cache_line_bytes = 64;
+
+/** Small dense indices for threads
+ *
+ * Every thread (std::thread, OpenMP or TBB worker alike) takes
+ * a free index the first time it asks and returns it when it
+ * exits so the indices stay below the most threads alive at
+ * once.
+ */
+class thread_index_pool {
+   public:
+    static thread_index_pool& instance() {
+        static thread_index_pool pool;
+        return pool;
+    }
+
+    std::size_t acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_.empty()) {
+            return next_++;
+        }
+        const auto index = free_.back();
+        free_.pop_back();
+        return index;
+    }
+
+    void release(const std::size_t index) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(index);
+    }
+
+   private:
+    std::mutex mutex_;
+    std::vector<std::size_t> free_;
+    std::size_t next_ = 0;
+};
+
+/** Index of the calling thread (fixed for the life of the thread)
+ */
+inline std::size_t this_thread_index() {
+    struct holder {
+        std::size_t index = thread_index_pool::instance().acquire();
+        ~holder() { thread_index_pool::instance().release(index); }
+    };
+    thread_local holder thread;
+    return thread.index;
+}
+
+/** Storage for one thread's value on its own cache lines
+ */
+template <typename T>
+struct alignas(std::max(cache_line_bytes, alignof(T))) per_thread_slot {
+    alignas(T) unsigned char storage[sizeof(T)];
+    bool constructed = false;
+
+    T& value() noexcept { return *std::launder(reinterpret_cast<T*>(storage)); }
+};
+
+} /* namespace detail */
+
+/** Value for each thread on its own cache lines (combinable)
+ *
+ * Each thread reaches its own value through local() so parallel
+ * accumulations need no locks or atomics and, because every
+ * slot is padded to whole cache lines, threads never write to
+ * the same line (false sharing).  A thread's value is created on
+ * its first call of local() from the initial value or factory.
+ * After the parallel work combine(op) folds the values together
+ * and for_each(f) visits them.
+ *
+ * Slots are found through a small index every thread takes once
+ * so lookup is lock free and works for std::thread, OpenMP and
+ * TBB threads alike.  Indices of exited threads are reused so a
+ * new thread may continue with the value left by an old one,
+ * which combine folds in all the same.
+ *
+ * local() may be called concurrently.  combine, for_each and
+ * clear must not run concurrently with local().
+ *
+ * \code{.cpp}
+ * xstd::per_thread<double> partial;
+ * std::for_each(std::execution::par, x.begin(), x.end(), [&](double v) { partial.local() += v * v; });
+ * double sum = partial.combine(std::plus<>());
+ * \endcode
+ */
+template <typename T>
+class per_thread {
+    using slot = detail::per_thread_slot<T>;
+
+    /// Segment k holds the 2^k slots of indices [2^k-1, 2^(k+1)-1)
+    static constexpr std::size_t max_segments = 48;
+
+   public:
+    using value_type = T;
+
+    /** Values start as T()
+     */
+    per_thread() : init_([]() { return T(); }) {}
+
+    /** Values start as a copy of value
+     */
+    explicit per_thread(const T& value) : init_([value]() { return value; }) {}
+
+    /** Values start as the result of factory()
+     */
+    template <typename Factory, typename = std::enable_if_t<std::is_invocable_r_v<T, Factory>>>
+    explicit per_thread(Factory factory) : init_(std::move(factory)) {}
+
+    per_thread(const per_thread&)            = delete;
+    per_thread& operator=(const per_thread&) = delete;
+
+    ~per_thread() {
+        this->clear();
+        for (std::size_t k = 0; k < max_segments; ++k) {
+            delete[] segments_[k].load(std::memory_order_acquire);
+        }
+    }
+
+    /** Value of the calling thread (created on first use)
+     */
+    T& local() {
+        bool exists;
+        return this->local(exists);
+    }
+
+    /** Value of the calling thread setting if it already existed
+     */
+    T& local(bool& exists) {
+        slot& s = this->slot_(detail::this_thread_index());
+        exists  = s.constructed;
+        if (not exists) {
+            ::new (static_cast<void*>(s.storage)) T(init_());
+            s.constructed = true;
+        }
+        return s.value();
+    }
+
+    /** Number of threads with a value
+     */
+    std::size_t size() const {
+        std::size_t count = 0;
+        this->visit_([&](slot&) { ++count; });
+        return count;
+    }
+
+    /** Fold the values of all threads with op
+     *
+     * Returns the initial value if no thread has a value.
+     */
+    template <typename BinaryOp>
+    T combine(BinaryOp op) const {
+        bool first = true;
+        T result   = init_();
+        this->visit_([&](slot& s) {
+            if (first) {
+                first  = false;
+                result = s.value();
+            } else {
+                result = op(result, s.value());
+            }
+        });
+        return result;
+    }
+
+    /** Call f(value) for the value of every thread
+     */
+    template <typename Function>
+    void for_each(Function f) {
+        this->visit_([&](slot& s) { f(s.value()); });
+    }
+
+    template <typename Function>
+    void for_each(Function f) const {
+        this->visit_([&](slot& s) { f(static_cast<const T&>(s.value())); });
+    }
+
+    /** Destroy the values of all threads
+     */
+    void clear() {
+        this->visit_([](slot& s) {
+            s.value().~T();
+            s.constructed = false;
+        });
+    }
+
+   private:
+    std::function<T()> init_;
+    mutable std::array<std::atomic<slot*>, max_segments> segments_{};
+
+    static std::size_t segment_size_(const std::size_t k) { return std::size_t(1) << k; }
+
+    /** Slot of an index allocating its segment if needed
+     */
+    slot& slot_(const std::size_t index) {
+        std::size_t k = 0;
+        while ((index + 1) >> (k + 1)) {
+            ++k;
+        }
+        const std::size_t offset = index + 1 - segment_size_(k);
+
+        slot* segment = segments_[k].load(std::memory_order_acquire);
+        if (segment == nullptr) {
+            slot* fresh = new slot[segment_size_(k)];
+            if (segments_[k].compare_exchange_strong(segment, fresh, std::memory_order_acq_rel)) {
+                segment = fresh;
+            } else {
+                delete[] fresh;  // Another thread installed it first
+            }
+        }
+        return segment[offset];
+    }
+
+    /** Call f(slot) for every slot holding a value
+     */
+    template <typename Function>
+    void visit_(Function&& f) const {
+        for (std::size_t k = 0; k < max_segments; ++k) {
+            slot* segment = segments_[k].load(std::memory_order_acquire);
+            if (segment == nullptr) {
+                continue;
+            }
+            for (std::size_t i = 0; i < segment_size_(k); ++i) {
+                if (segment[i].constructed) {
+                    f(segment[i]);
+                }
+            }
+        }
+    }
+};
+
+} /* namespace xstd */
@@ -0,0 +1,242 @@
+/**
+ * \file       pipeline.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>           // std::min, std::max
+#include <condition_variable>  // std::condition_variable
+#include <cstddef>             // std::size_t
+#include <exception>           // std::exception_ptr
+#include <iterator>            // std::iterator_traits
+#include <mutex>               // std::mutex, std::unique_lock
+#include <thread>              // std::thread
+#include <tuple>               // std::tuple, std::get
+#include <type_traits>         // std::integral_constant
+#include <utility>             // std::index_sequence
+#include <vector>              // std::vector
+
+namespace xstd {
+namespace detail {
+
+/** Progress shared between the stages of a pipeline
+ *
+ * Each stage records the number of chunks it has completed.
+ * A stage may start chunk k once the previous stage has completed
+ * chunk k.  The first stage may only start chunk k once the last
+ * stage has retired chunk (k - max_in_flight) which bounds the
+ * number of chunks alive at any time.
+ */
+class pipeline_state {
+   public:
+    pipeline_state(const std::size_t nstages, const std::size_t max_in_flight)
+        : completed_(nstages, 0), max_in_flight_(max_in_flight), aborted_(false) {}
+
+    /** Block until stage is allowed to process chunk
+     *
+     * Returns false if another stage failed and the pipeline
+     * is shutting down.
+     */
+    bool wait(const std::size_t stage, const std::size_t chunk) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [&]() { return aborted_ or this->ready_(stage, chunk); });
+        return not aborted_;
+    }
+
+    /** Mark chunk as completed by stage
+     */
+    void complete(const std::size_t stage, const std::size_t chunk) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            completed_[stage] = chunk + 1;
+        }
+        cond_.notify_all();
+    }
+
+    /** Stop all stages after capturing the first failure
+     */
+    void abort(std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (not aborted_) {
+                error_   = error;
+                aborted_ = true;
+            }
+        }
+        cond_.notify_all();
+    }
+
+    /** Rethrow the first failure (if any)
+     */
+    void rethrow() const {
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+   private:
+    std::vector<std::size_t> completed_;
+    std::size_t max_in_flight_;
+    bool aborted_;
+    std::exception_ptr error_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+
+    bool ready_(const std::size_t stage, const std::size_t chunk) const {
+        if (stage == 0) {
+            return chunk < completed_.back() + max_in_flight_;
+        }
+        return chunk < completed_[stage - 1];
+    }
+};
+
+} /* namespace detail */
+
+/** Chunked pipeline over a range of values
+ *
+ * Splits the provided range into cache sized chunks and passes
+ * each chunk through every stage while it is still in cache
+ * instead of having each stage sweep the full range.  Every
+ * stage runs on its own thread so different chunks are processed
+ * by different stages concurrently.  At most max_in_flight chunks
+ * are between the first and last stage at any time.
+ *
+ * Each stage is called as stage(chunk_first, chunk_last) for
+ * every chunk in order by exactly one thread so stages may hold
+ * state (ex. a running reduction) without synchronization. A stage
+ * is free to use a parallel execution policy within its chunk.
+ *
+ * \code{.cpp}
+ * std::vector<double> x(N);
+ * double sum = 0;
+ * xstd::pipeline pipe;
+ * pipe.run(x,
+ *     [](auto first, auto last){ std::transform(first, last, first, decode); },
+ *     [&](auto first, auto last){ sum = std::accumulate(first, last, sum); });
+ * \endcode
+ */
+class pipeline {
+   public:
+    /// Target size of a chunk when none is provided
+    static constexpr std::size_t default_chunk_bytes = 256 * 1024;
+
+    /// Default number of chunks in flight (double buffering)
+    static constexpr std::size_t default_max_in_flight = 2;
+
+    /** Construct the pipeline
+     *
+     * \param chunk_size[in] Number of elements per chunk (0 selects cache sized chunks)
+     * \param max_in_flight[in] Maximum number of chunks between first and last stage
+     */
+    explicit pipeline(const std::size_t chunk_size    = 0,
+                      const std::size_t max_in_flight = default_max_in_flight)
+        : chunk_size_(chunk_size), max_in_flight_(std::max<std::size_t>(max_in_flight, 1)) {}
+
+    /** Number of chunks allowed in flight
+     */
+    std::size_t max_in_flight() const noexcept { return max_in_flight_; }
+
+    /** Number of elements per chunk for a value type
+     */
+    template <typename ValueType>
+    std::size_t chunk_size() const noexcept {
+        if (chunk_size_ > 0) {
+            return chunk_size_;
+        }
+        return std::max<std::size_t>(default_chunk_bytes / sizeof(ValueType), 1);
+    }
+
+    /** Pass all chunks of range through the stages
+     *
+     * The range can be any type providing random access
+     * begin() and end() (ex. containers, xstd::range,
+     * xstd::strided or xstd::zip).  The last stage runs on the
+     * calling thread.  If any stage throws the pipeline stops
+     * and the first exception is rethrown after all threads join.
+     *
+     * \param range[in] Range to split into chunks
+     * \param stages[in] Callables invoked as stage(chunk_first, chunk_last)
+     */
+    template <typename Range, typename... Stages>
+    void run(Range&& range, Stages&&... stages) const {
+        static_assert(sizeof...(Stages) > 0, "Pipeline requires at least one stage");
+        auto first = range.begin();
+        auto last  = range.end();
+
+        using iterator        = decltype(first);
+        using value_type      = typename std::iterator_traits<iterator>::value_type;
+        using difference_type = typename std::iterator_traits<iterator>::difference_type;
+
+        const difference_type length = last - first;
+        if (length <= 0) {
+            return;
+        }
+        const auto chunk   = static_cast<difference_type>(this->chunk_size<value_type>());
+        const auto nchunks = static_cast<std::size_t>((length + chunk - 1) / chunk);
+
+        detail::pipeline_state state(sizeof...(Stages), max_in_flight_);
+        auto stage_tuple = std::forward_as_tuple(stages...);
+        launch_(state, stage_tuple, first, length, chunk, nchunks, std::index_sequence_for<Stages...>{});
+        state.rethrow();
+    }
+
+   private:
+    std::size_t chunk_size_;
+    std::size_t max_in_flight_;
+
+    template <typename Stage, typename Iterator, typename Difference>
+    static void drive_(detail::pipeline_state& state, const std::size_t index, Stage& stage, Iterator first,
+                       const Difference length, const Difference chunk, const std::size_t nchunks) {
+        try {
+            for (std::size_t k = 0; k < nchunks; ++k) {
+                if (not state.wait(index, k)) {
+                    return;
+                }
+                const auto offset = static_cast<Difference>(k) * chunk;
+                const auto count  = std::min(chunk, length - offset);
+                stage(first + offset, first + (offset + count));
+                state.complete(index, k);
+            }
+        } catch (...) {
+            state.abort(std::current_exception());
+        }
+    }
+
+    template <typename StageTuple, typename Iterator, typename Difference, std::size_t... I>
+    static void launch_(detail::pipeline_state& state, StageTuple& stages, Iterator first, const Difference length,
+                        const Difference chunk, const std::size_t nchunks, std::index_sequence<I...>) {
+        constexpr std::size_t nstages = sizeof...(I);
+
+        // Started threads are joined also when a later one fails to start
+        std::vector<std::thread> threads;
+        struct join_guard {
+            std::vector<std::thread>& threads;
+            ~join_guard() {
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            }
+        } guard{threads};
+
+        auto spawn = [&](auto index, auto& stage) {
+            if constexpr (decltype(index)::value + 1 < nstages) {
+                threads.emplace_back([&state, &stage, first, length, chunk, nchunks]() {
+                    drive_(state, decltype(index)::value, stage, first, length, chunk, nchunks);
+                });
+            }
+        };
+        try {
+            threads.reserve(nstages - 1);
+            (spawn(std::integral_constant<std::size_t, I>{}, std::get<I>(stages)), ...);
+        } catch (...) {
+            // Release the started stages, the error is rethrown once they join
+            state.abort(std::current_exception());
+        }
+
+        // Last stage runs on the calling thread (returns at once if aborted)
+        drive_(state, nstages - 1, std::get<nstages - 1>(stages), first, length, chunk, nchunks);
+    }
+};
+
+} /* namespace xstd */
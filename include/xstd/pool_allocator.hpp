@@ -0,0 +1,293 @@
+/**
+ * \file       pool_allocator.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <atomic>   // std::atomic
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uintptr_t
+#include <limits>   // std::numeric_limits
+#include <mutex>    // std::mutex, std::lock_guard
+#include <new>      // std::align_val_t, std::bad_array_new_length
+#include <vector>   // std::vector
+
+namespace xstd {
+namespace detail {
+
+/// Size and alignment of a slab carved into blocks of one size class
+inline constexpr std::size_t pool_slab_size = std::size_t(64) * 1024;
+
+/// Smallest size class (also the alignment of every block)
+inline constexpr std::size_t pool_min_size = 16;
+
+/// Number of size classes (16, 32, ..., 2048 bytes)
+inline constexpr std::size_t pool_num_classes = 8;
+
+/// Largest request served from the pool
+inline constexpr std::size_t pool_max_size = pool_min_size << (pool_num_classes - 1);
+
+/** Size class holding requests of bytes
+ */
+inline std::size_t pool_size_class(const std::size_t bytes) noexcept {
+    std::size_t k    = 0;
+    std::size_t size = pool_min_size;
+    while (size < bytes) {
+        size <<= 1;
+        ++k;
+    }
+    return k;
+}
+
+/** Free block threaded onto a free list
+ */
+struct pool_block {
+    pool_block* next;
+};
+
+struct pool_cache;
+
+/** Header at the start of every slab
+ *
+ * Slabs are aligned to their size so the header of any block
+ * is found by masking its address.
+ */
+struct alignas(64) pool_slab {
+    pool_cache* owner;
+    std::size_t size_class;
+};
+
+inline pool_slab* pool_slab_of(const void* ptr) noexcept {
+    return reinterpret_cast<pool_slab*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(pool_slab_size - 1));
+}
+
+/** Cache of free blocks owned by one thread at a time
+ *
+ * Only the owning thread touches the free lists and slabs.
+ * Other threads return blocks through the remote list which
+ * is a lock-free stack pushed with compare-and-swap and drained
+ * all at once by the owner with an exchange.
+ */
+struct pool_cache {
+    pool_block* free[pool_num_classes] = {};
+    char* bump[pool_num_classes]       = {};
+    char* bump_end[pool_num_classes]   = {};
+    std::atomic<pool_block*> remote{nullptr};
+
+    void* allocate(const std::size_t k) {
+        if (free[k] == nullptr and remote.load(std::memory_order_relaxed) != nullptr) {
+            this->drain_remote();
+        }
+        if (auto block = free[k]) {
+            free[k] = block->next;
+            return block;
+        }
+        if (bump[k] == bump_end[k]) {
+            this->add_slab(k);
+        }
+        void* ptr = bump[k];
+        bump[k] += (pool_min_size << k);
+        return ptr;
+    }
+
+    void deallocate(void* ptr, const std::size_t k) noexcept {
+        auto block = static_cast<pool_block*>(ptr);
+        block->next = free[k];
+        free[k]     = block;
+    }
+
+    void deallocate_remote(void* ptr) noexcept {
+        auto block  = static_cast<pool_block*>(ptr);
+        block->next = remote.load(std::memory_order_relaxed);
+        while (not remote.compare_exchange_weak(block->next, block, std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+        }
+    }
+
+    void drain_remote() noexcept {
+        auto block = remote.exchange(nullptr, std::memory_order_acquire);
+        while (block != nullptr) {
+            auto next = block->next;
+            this->deallocate(block, pool_slab_of(block)->size_class);
+            block = next;
+        }
+    }
+
+    void add_slab(const std::size_t k) {
+        auto mem = static_cast<char*>(::operator new(pool_slab_size, std::align_val_t(pool_slab_size)));
+        ::new (mem) pool_slab{this, k};
+        const auto bsize = pool_min_size << k;
+        bump[k]          = mem + sizeof(pool_slab);
+        bump_end[k]      = bump[k] + ((pool_slab_size - sizeof(pool_slab)) / bsize) * bsize;
+    }
+};
+
+/** Registry recycling the caches of exited threads
+ *
+ * Caches are never destroyed since blocks they own may still be
+ * in use (or in flight on their remote list).  A thread starting
+ * later adopts an idle cache together with its slabs.  The
+ * registry itself is intentionally leaked so it outlives every
+ * static container using the pool (see pool_thread_state).
+ */
+struct pool_registry {
+    std::mutex mutex;
+    std::vector<pool_cache*> idle;
+
+    static pool_registry& instance() {
+        static pool_registry* registry = new pool_registry();
+        return *registry;
+    }
+
+    pool_cache* acquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (idle.empty()) {
+            return new pool_cache();
+        }
+        auto cache = idle.back();
+        idle.pop_back();
+        return cache;
+    }
+
+    void release(pool_cache* cache) {
+        std::lock_guard<std::mutex> lock(mutex);
+        idle.push_back(cache);
+    }
+};
+
+/** Cache of the calling thread (trivially destructible)
+ *
+ * The thread's cache returns to the registry when the thread
+ * exits.  Static destructors run after the main thread's
+ * thread_local objects are gone so the pointer is cleared and
+ * retired set: blocks freed from then on go to their owner's
+ * remote list and blocks allocated come from a cache which is
+ * never returned.
+ */
+struct pool_thread_state {
+    pool_cache* cache = nullptr;
+    bool retired      = false;
+};
+
+inline thread_local pool_thread_state pool_thread;
+
+/** Cache of the calling thread
+ */
+inline pool_cache& local_pool_cache() {
+    struct handle {
+        ~handle() {
+            pool_registry::instance().release(pool_thread.cache);
+            pool_thread.cache   = nullptr;
+            pool_thread.retired = true;
+        }
+    };
+    if (pool_thread.cache == nullptr) {
+        pool_thread.cache = pool_registry::instance().acquire();
+        if (not pool_thread.retired) {
+            thread_local handle local;
+        }
+    }
+    return *pool_thread.cache;
+}
+
+} /* namespace detail */
+
+/** Allocate bytes from the calling thread's pool
+ *
+ * Requests above 2048 bytes go to the global operator new.
+ * The returned memory is aligned to 16 bytes.
+ */
+inline void* pool_allocate(const std::size_t bytes) {
+    if (bytes > detail::pool_max_size) {
+        return ::operator new(bytes);
+    }
+    return detail::local_pool_cache().allocate(detail::pool_size_class(bytes));
+}
+
+/** Return memory from pool_allocate
+ *
+ * May be called from any thread.  Blocks freed by a thread
+ * other than the owner of their slab are returned to the owner
+ * through its remote free list.
+ *
+ * \param ptr[in] Pointer returned by pool_allocate
+ * \param bytes[in] Size passed to pool_allocate
+ */
+inline void pool_deallocate(void* ptr, const std::size_t bytes) noexcept {
+    if (bytes > detail::pool_max_size) {
+        ::operator delete(ptr);
+        return;
+    }
+    auto cache = detail::pool_thread.cache;
+    auto slab  = detail::pool_slab_of(ptr);
+    if (slab->owner == cache) {
+        cache->deallocate(ptr, slab->size_class);
+    } else {
+        slab->owner->deallocate_remote(ptr);
+    }
+}
+
+/** Allocator for small objects using thread-caching pools
+ *
+ * Small requests are served from per-thread free lists of
+ * fixed size classes (16 to 2048 bytes) carved from 64 KB
+ * slabs.  Allocation and deallocation by the owning thread take
+ * no locks and no atomic read-modify-write operations.  Memory freed by another thread is
+ * pushed onto the owner's lock-free remote free list and reused
+ * by the owner once its own list runs dry.  Memory is kept by
+ * the pool for reuse and not returned to the system.
+ *
+ * Intended for the many small short lived containers created
+ * inside parallel algorithms (ex. work lists per column).
+ *
+ * \tparam T Type of value to allocate
+ *
+ * \code{.cpp}
+ * std::for_each(std::execution::par, cols.begin(), cols.end(), [](auto col) {
+ *     std::vector<int, xstd::pool_allocator<int>> work;
+ *     ...
+ * });
+ * \endcode
+ */
+template <typename T>
+class pool_allocator {
+   public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    template <typename U>
+    struct rebind {
+        using other = pool_allocator<U>;
+    };
+
+    pool_allocator() noexcept = default;
+
+    template <typename U>
+    pool_allocator(const pool_allocator<U>&) noexcept {}
+
+    T* allocate(const std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        if constexpr (alignof(T) > detail::pool_min_size) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        } else {
+            return static_cast<T*>(xstd::pool_allocate(n * sizeof(T)));
+        }
+    }
+
+    void deallocate(T* ptr, const std::size_t n) noexcept {
+        if constexpr (alignof(T) > detail::pool_min_size) {
+            ::operator delete(ptr, std::align_val_t(alignof(T)));
+        } else {
+            xstd::pool_deallocate(ptr, n * sizeof(T));
+        }
+    }
+
+    friend bool operator==(const pool_allocator&, const pool_allocator&) noexcept { return true; }
+
+    friend bool operator!=(const pool_allocator&, const pool_allocator&) noexcept { return false; }
+};
+
+} /* namespace xstd */
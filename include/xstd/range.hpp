@@ -5,9 +5,11 @@
  */
 #pragma once
 
-#include <cassert>   // assert
-#include <cstddef>   // std::size_t, std::ptrdiff_t;
-#include <iterator>  // std::random_access_iterator_tag
+#include <cassert>      // assert
+#include <cmath>        // std::ceil
+#include <cstddef>      // std::size_t, std::ptrdiff_t;
+#include <iterator>     // std::random_access_iterator_tag
+#include <type_traits>  // std::is_integral_v
 
 namespace xstd {
 
@@ -35,8 +37,8 @@ struct range_iterator {
 
     using difference_type   = std::ptrdiff_t;
     using value_type        = Incrementable;
-    using pointer           = value_type*;
-    using reference         = value_type&;
+    using pointer           = void;
+    using reference         = value_type;  // Values are generated so returned by value
     using iterator_category = std::random_access_iterator_tag;
 
     // ====================================================
@@ -45,7 +47,7 @@ struct range_iterator {
 
     range_iterator() : value_(0), step_(1) {}
 
-    range_iterator(const range_iterator& other) : value_(other.value_), step_(other.step_) {}
+    range_iterator(const range_iterator& other) = default;
 
     explicit range_iterator(const value_type& value) : value_(value), step_(1) {}
 
@@ -55,11 +57,7 @@ struct range_iterator {
     // Operators
     // ====================================================
 
-    range_iterator& operator=(range_iterator other) {
-        assert(step_ == other.step_);
-        std::swap(value_, other.value_);
-        return *this;
-    }
+    range_iterator& operator=(const range_iterator& other) = default;
 
     range_iterator& operator++() {
         value_ += step_;
@@ -93,9 +91,9 @@ struct range_iterator {
         return *this;
     }
 
-    value_type operator[](const difference_type n) { return value_ + n * step_; }
+    reference operator[](const difference_type n) const { return value_ + n * step_; }
 
-    value_type operator*() { return value_; }
+    reference operator*() const { return value_; }
 
     // ====================================================
     // Friend Operators
@@ -103,25 +101,34 @@ struct range_iterator {
 
     friend bool operator==(const range_iterator& x, const range_iterator& y) {
         assert(x.step_ == y.step_);
-        return x.step_ > 0 ? (y.value_ < x.value_) || (y.value_ == x.value_) : (x.value_ < y.value_);
+        return x.value_ == y.value_;
     }
 
     friend bool operator!=(const range_iterator& x, const range_iterator& y) { return not(x == y); }
 
-    friend bool operator<(const range_iterator& x, const range_iterator& y) { return x.value_ < y.value_; }
+    friend bool operator<(const range_iterator& x, const range_iterator& y) { return (x - y) < 0; }
+
+    friend bool operator>(const range_iterator& x, const range_iterator& y) { return y < x; }
+
+    friend bool operator<=(const range_iterator& x, const range_iterator& y) { return not(y < x); }
+
+    friend bool operator>=(const range_iterator& x, const range_iterator& y) { return not(x < y); }
 
     friend difference_type operator-(const range_iterator& x, const range_iterator& y) {
         assert(x.step_ == y.step_);
-        return (x.value_ - y.value_) / x.step_;
+        return (static_cast<difference_type>(x.value_) - static_cast<difference_type>(y.value_)) /
+               static_cast<difference_type>(x.step_);
     }
 
-    friend range_iterator operator+(range_iterator x, difference_type y) { return x += y * x.step_; }
+    friend range_iterator operator+(range_iterator x, const difference_type y) { return x += y; }
+
+    friend range_iterator operator+(const difference_type x, range_iterator y) { return y += x; }
 
-    friend range_iterator operator+(difference_type x, range_iterator y) { return y += x * y.step_; }
+    friend range_iterator operator-(range_iterator x, const difference_type y) { return x -= y; }
 
    private:
     Incrementable value_;
-    const Incrementable step_;
+    Incrementable step_;
 };
 
 /**
@@ -135,7 +142,7 @@ template <typename T>
 struct range_proxy {
     range_proxy() = delete;
 
-    range_proxy(T first, T last, T step = 1) : first_(first), last_(last), step_(step) {}
+    range_proxy(T first, T last, T step = 1) : first_(first), last_(aligned_last(first, last, step)), step_(step) {}
 
     ~range_proxy() = default;
 
@@ -151,6 +158,28 @@ struct range_proxy {
     const T first_;
     const T last_;
     const T step_;
+
+    /** First value of the sequence at or beyond last
+     *
+     * The end iterator is placed on the sequence so iterators
+     * compare equal exactly instead of testing for overshoot.
+     */
+    static T aligned_last(const T first, const T last, const T step) {
+        assert(step != T(0));
+        if (step > T(0) ? not(first < last) : not(last < first)) {
+            return first;
+        }
+        if constexpr (std::is_integral_v<T>) {
+            const T span = last - first;
+            T n          = span / step;
+            if (n * step != span) {
+                ++n;
+            }
+            return first + n * step;
+        } else {
+            return first + std::ceil((last - first) / step) * step;
+        }
+    }
 };  // struct range_proxy
 
 /**
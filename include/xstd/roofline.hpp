@@ -0,0 +1,478 @@
+/**
+ * \file       roofline.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::max, std::max_element, std::min, std::fill
+#include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <cstddef>      // std::size_t
+#include <cstdlib>      // std::strtod
+#include <istream>      // std::istream
+#include <iterator>     // std::istreambuf_iterator
+#include <ostream>      // std::ostream
+#include <string>       // std::string
+#include <thread>       // std::thread
+#include <type_traits>  // std::conditional_t
+#include <vector>       // std::vector
+
+#if __has_include(<unistd.h>)
+#include <unistd.h>  // sysconf
+#endif
+
+#include "xstd/simd.hpp"
+#include "xstd/stop_watch.hpp"
+
+namespace xstd {
+namespace detail {
+
+/** Data cache sizes (L1, L2, L3) in bytes of the host
+ *
+ * Taken from sysconf where the C library reports them and
+ * typical sizes otherwise.
+ */
+inline std::array<std::size_t, 3> data_cache_sizes() {
+    std::array<std::size_t, 3> sizes = {32 * 1024, 1024 * 1024, 32 * 1024 * 1024};
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    const std::array<long, 3> found = {::sysconf(_SC_LEVEL1_DCACHE_SIZE), ::sysconf(_SC_LEVEL2_CACHE_SIZE),
+                                       ::sysconf(_SC_LEVEL3_CACHE_SIZE)};
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        if (found[i] > 0) {
+            sizes[i] = static_cast<std::size_t>(found[i]);
+        }
+    }
+#endif
+    return sizes;
+}
+
+/** Run function(thread_index) on a team of threads
+ *
+ * Each function does its own setup (so memory is first touched
+ * by the thread using it), waits on the barrier and returns the
+ * seconds its timed region took.  Returns the slowest thread's
+ * time which is the time of the concurrent region.
+ */
+template <typename Function>
+double run_team(const std::size_t nthreads, Function&& function) {
+    std::vector<double> seconds(nthreads);
+    std::vector<std::thread> team;
+    for (std::size_t t = 0; t < nthreads; ++t) {
+        team.emplace_back([&, t]() { seconds[t] = function(t); });
+    }
+    for (auto& thread : team) {
+        thread.join();
+    }
+    return *std::max_element(seconds.begin(), seconds.end());
+}
+
+/** Barrier for the threads of one team
+ */
+class spin_barrier {
+   public:
+    explicit spin_barrier(const std::size_t count) : count_(count) {}
+
+    void arrive_and_wait() noexcept {
+        ++arrived_;
+        while (arrived_.load() < count_) {
+            std::this_thread::yield();
+        }
+    }
+
+   private:
+    const std::size_t count_;
+    std::atomic<std::size_t> arrived_{0};
+};
+
+/// Keeps the results of the probes from being optimized away
+inline std::atomic<double> roofline_sink{0};
+
+/** Seconds for every thread to run a chain of multiply-adds
+ *
+ * Eight independent accumulators hide the latency of the
+ * multiply-add so the loop runs at the throughput of the FPU.
+ * Compilers contract each pair into an FMA when the target has
+ * one.  A width of one double uses plain scalar arithmetic.
+ */
+template <std::size_t Bytes>
+double multiply_add_seconds(const std::size_t nthreads, const std::size_t iterations) {
+    constexpr bool scalar   = (Bytes == sizeof(double));
+    using pack              = std::conditional_t<scalar, double, simd_pack<double, Bytes>>;
+    constexpr std::size_t N = 8;
+    auto broadcast          = [](const double value) {
+        if constexpr (scalar) {
+            return value;
+        } else {
+            return pack::broadcast(value);
+        }
+    };
+    spin_barrier barrier(nthreads);
+    return run_team(nthreads, [&](std::size_t) {
+        const pack m = broadcast(0.999999);
+        const pack c = broadcast(1.0e-6);
+        std::array<pack, N> acc;
+        for (std::size_t j = 0; j < N; ++j) {
+            acc[j] = broadcast(1.0 + 1.0e-3 * j);
+        }
+        barrier.arrive_and_wait();
+        StopWatch watch;
+        watch.start();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                acc[j] = acc[j] * m + c;
+            }
+        }
+        watch.stop();
+        double sum = 0;
+        for (std::size_t j = 0; j < N; ++j) {
+            if constexpr (scalar) {
+                sum += acc[j];
+            } else {
+                sum += acc[j][0];
+            }
+        }
+        roofline_sink = roofline_sink + sum;
+        return watch.elapsed_seconds();
+    });
+}
+
+/// Memory kernels of the bandwidth probe
+enum class memory_kernel { read, write, triad, update };
+
+/** Seconds for every thread to stream its own arrays
+ *
+ * Each thread owns arrays holding bytes in total and sweeps them
+ * repeat times.  The read sums one array (into independent
+ * partial sums so the additions are not one dependent chain),
+ * write fills one array, the triad computes a = b + s * c over
+ * three arrays and the update a = a + s * b over two.  Writing a
+ * new array also reads it into cache first (write allocate)
+ * which the bytes moved do not count, so the triad understates
+ * what an in place update (ex. SAXPY) reaches.
+ */
+inline double memory_seconds(const memory_kernel kernel, const std::size_t nthreads, const std::size_t bytes,
+                             const std::size_t repeat) {
+    const std::size_t narrays = (kernel == memory_kernel::triad) ? 3 : (kernel == memory_kernel::update) ? 2 : 1;
+    const std::size_t n       = std::max<std::size_t>(bytes / (narrays * sizeof(double)), 1);
+    spin_barrier barrier(nthreads);
+    return run_team(nthreads, [&](std::size_t) {
+        std::vector<double> a(n, 1.0), b(narrays > 1 ? n : 0, 2.0), c(narrays > 1 ? n : 0, 3.0);
+        double sum = 0;
+        barrier.arrive_and_wait();
+        StopWatch watch;
+        watch.start();
+        for (std::size_t r = 0; r < repeat; ++r) {
+            if (kernel == memory_kernel::read) {
+                constexpr std::size_t P = 8;
+                std::array<double, P> partial{};
+                std::size_t i = 0;
+                for (; i + P <= n; i += P) {
+                    for (std::size_t p = 0; p < P; ++p) {
+                        partial[p] += a[i + p];
+                    }
+                }
+                for (; i < n; ++i) {
+                    partial[0] += a[i];
+                }
+                for (std::size_t p = 0; p < P; ++p) {
+                    sum += partial[p];
+                }
+            } else if (kernel == memory_kernel::write) {
+                std::fill(a.begin(), a.end(), static_cast<double>(r));
+            } else if (kernel == memory_kernel::triad) {
+                const double s = 1.0 + 1.0e-9 * r;
+                for (std::size_t i = 0; i < n; ++i) {
+                    a[i] = b[i] + s * c[i];
+                }
+            } else {
+                const double s = 1.0e-9 * r;
+                for (std::size_t i = 0; i < n; ++i) {
+                    a[i] += s * b[i];
+                }
+            }
+        }
+        watch.stop();
+        roofline_sink = roofline_sink + sum + a[n / 2];
+        return watch.elapsed_seconds();
+    });
+}
+
+/** Text of the value following "key": within a JSON object
+ */
+inline std::string json_value(const std::string& object, const std::string& key) {
+    const auto at = object.find("\"" + key + "\"");
+    if (at == std::string::npos) {
+        return {};
+    }
+    auto first = object.find(':', at) + 1;
+    while (first < object.size() and object[first] == ' ') {
+        ++first;
+    }
+    if (first < object.size() and object[first] == '"') {
+        return object.substr(first + 1, object.find('"', first + 1) - first - 1);
+    }
+    return object.substr(first, object.find_first_of(",}", first) - first);
+}
+
+/** Objects of the JSON array named key
+ *
+ * Only handles the flat objects written by roofline::write_json.
+ */
+inline std::vector<std::string> json_objects(const std::string& text, const std::string& key) {
+    std::vector<std::string> objects;
+    const auto at = text.find("\"" + key + "\"");
+    if (at == std::string::npos) {
+        return objects;
+    }
+    const auto last = text.find(']', at);
+    auto first      = text.find('{', at);
+    while (first < last) {
+        const auto end = text.find('}', first);
+        objects.push_back(text.substr(first, end - first + 1));
+        first = text.find('{', end);
+    }
+    return objects;
+}
+
+} /* namespace detail */
+
+/** Roofline of the host
+ *
+ * Peak multiply-add rates (scalar and each SIMD width) and read,
+ * write, triad and update bandwidths with working sets sized for each
+ * cache level and main memory on 1 to N threads.  The attainable
+ * rate of a kernel with arithmetic intensity I (FLOP/byte) is
+ * min(peak FLOP rate, I * bandwidth) which places any measured
+ * result on the chart.
+ *
+ * Measuring takes a few seconds per thread count so the result
+ * is written as JSON once and read back by later runs.
+ *
+ * \code{.cpp}
+ * auto roof = xstd::roofline::measure();
+ * std::ofstream("roofline.json") << roof;
+ * double limit = roof.attainable_gflops(2.0 / 24.0);  // SAXPY from main memory
+ * \endcode
+ */
+struct roofline {
+
+    /// Multiply-add throughput of one vector width
+    struct compute_rate {
+        std::string kernel;         // scalar or simd
+        std::size_t width   = 1;    // doubles per operation
+        std::size_t threads = 1;
+        double gflops       = 0;
+    };
+
+    /// Bandwidth of one working set size
+    struct bandwidth_rate {
+        std::string level;          // L1, L2, L3 or DRAM
+        std::size_t bytes   = 0;    // Working set of each thread
+        std::size_t threads = 1;
+        double read_gbs     = 0;
+        double write_gbs    = 0;
+        double triad_gbs    = 0;
+        double update_gbs   = 0;
+    };
+
+    std::vector<compute_rate> compute;
+    std::vector<bandwidth_rate> bandwidth;
+
+    /** Measured thread count standing in for a run on threads threads
+     *
+     * The most threads measured not above threads (the fewest
+     * measured when every row is above) so a serial run is rated
+     * against the single thread roof.  Zero stands for any count.
+     */
+    std::size_t nearest_threads(const std::size_t threads) const {
+        if (threads == 0) {
+            return 0;
+        }
+        std::size_t below = 0;
+        std::size_t above = 0;
+        auto visit = [&](const std::size_t measured) {
+            if (measured <= threads) {
+                below = std::max(below, measured);
+            } else if (above == 0 or measured < above) {
+                above = measured;
+            }
+        };
+        for (const auto& rate : compute) {
+            visit(rate.threads);
+        }
+        for (const auto& rate : bandwidth) {
+            visit(rate.threads);
+        }
+        return (below > 0) ? below : above;
+    }
+
+    /** Fastest multiply-add rate measured (GFLOP/s)
+     *
+     * Only rows of nearest_threads(threads) count when threads
+     * is given.
+     */
+    double peak_gflops(const std::size_t threads = 0) const {
+        const auto measured = this->nearest_threads(threads);
+        double peak         = 0;
+        for (const auto& rate : compute) {
+            if (measured == 0 or rate.threads == measured) {
+                peak = std::max(peak, rate.gflops);
+            }
+        }
+        return peak;
+    }
+
+    /** Fastest read, triad or update bandwidth of a level (GB/s)
+     *
+     * Only rows of nearest_threads(threads) count when threads
+     * is given.
+     */
+    double peak_bandwidth_gbs(const std::string& level = "DRAM", const std::size_t threads = 0) const {
+        const auto measured = this->nearest_threads(threads);
+        double peak         = 0;
+        for (const auto& rate : bandwidth) {
+            if (rate.level == level and (measured == 0 or rate.threads == measured)) {
+                peak = std::max({peak, rate.read_gbs, rate.triad_gbs, rate.update_gbs});
+            }
+        }
+        return peak;
+    }
+
+    /** Attainable GFLOP/s at an arithmetic intensity (FLOP/byte)
+     *
+     * Rated on the roof of nearest_threads(threads) when threads
+     * is given and on the fastest rows otherwise.
+     */
+    double attainable_gflops(const double intensity, const std::string& level = "DRAM",
+                             const std::size_t threads = 0) const {
+        return std::min(this->peak_gflops(threads), intensity * this->peak_bandwidth_gbs(level, threads));
+    }
+
+    /** Measure the roofline using 1 to max_threads threads
+     *
+     * Thread counts double from 1 and always include max_threads.
+     */
+    static roofline measure(const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency())) {
+        constexpr std::size_t fma_iterations = std::size_t(1) << 24;
+        constexpr std::size_t sweep_bytes    = std::size_t(1) << 30;  // Bytes moved per thread
+        constexpr std::size_t trials         = 3;
+
+        std::vector<std::size_t> thread_counts;
+        for (std::size_t n = 1; n < max_threads; n *= 2) {
+            thread_counts.push_back(n);
+        }
+        thread_counts.push_back(max_threads);
+
+        const auto caches = detail::data_cache_sizes();
+        const std::array<std::string, 4> levels = {"L1", "L2", "L3", "DRAM"};
+
+        roofline roof;
+        for (const auto nthreads : thread_counts) {
+            auto flops = [&](const char* kernel, const std::size_t width, auto seconds) {
+                double best = 0;
+                for (std::size_t t = 0; t < trials; ++t) {
+                    const double ops = 2.0 * 8 * width * fma_iterations * nthreads;
+                    best             = std::max(best, ops / seconds() / 1.0e9);
+                }
+                roof.compute.push_back({kernel, width, nthreads, best});
+            };
+            flops("scalar", 1, [&]() { return detail::multiply_add_seconds<sizeof(double)>(nthreads, fma_iterations); });
+            flops("simd", 16 / sizeof(double), [&]() { return detail::multiply_add_seconds<16>(nthreads, fma_iterations); });
+            if constexpr (detail::native_simd_bytes > 16) {
+                flops("simd", detail::native_simd_bytes / sizeof(double), [&]() {
+                    return detail::multiply_add_seconds<detail::native_simd_bytes>(nthreads, fma_iterations);
+                });
+            }
+
+            for (std::size_t l = 0; l < levels.size(); ++l) {
+                // Half of a private cache per thread, half of the shared L3 split
+                // across threads and main memory well beyond the L3
+                std::size_t bytes = caches[std::min<std::size_t>(l, 2)] / 2;
+                if (l == 2) {
+                    bytes = std::max(bytes / nthreads, caches[1]);
+                } else if (l == 3) {
+                    bytes = std::max<std::size_t>(4 * caches[2], std::size_t(256) << 20) / nthreads;
+                }
+                const std::size_t repeat = std::max<std::size_t>(sweep_bytes / bytes, 2);
+                const double moved       = double(bytes) * repeat * nthreads;
+
+                bandwidth_rate rate{levels[l], bytes, nthreads};
+                for (std::size_t t = 0; t < trials; ++t) {
+                    using detail::memory_kernel;
+                    const double read   = detail::memory_seconds(memory_kernel::read, nthreads, bytes, repeat);
+                    const double write  = detail::memory_seconds(memory_kernel::write, nthreads, bytes, repeat);
+                    const double triad  = detail::memory_seconds(memory_kernel::triad, nthreads, bytes, repeat);
+                    const double update = detail::memory_seconds(memory_kernel::update, nthreads, bytes, repeat);
+                    rate.read_gbs       = std::max(rate.read_gbs, moved / read / 1.0e9);
+                    rate.write_gbs      = std::max(rate.write_gbs, moved / write / 1.0e9);
+                    rate.triad_gbs      = std::max(rate.triad_gbs, moved / triad / 1.0e9);
+                    rate.update_gbs     = std::max(rate.update_gbs, 1.5 * moved / update / 1.0e9);
+                }
+                roof.bandwidth.push_back(rate);
+            }
+        }
+        return roof;
+    }
+
+    /** Write the roofline as JSON
+     */
+    void write_json(std::ostream& os) const {
+        os << "{\n";
+        os << "  \"peak_gflops\": " << this->peak_gflops() << ",\n";
+        os << "  \"peak_dram_gbs\": " << this->peak_bandwidth_gbs("DRAM") << ",\n";
+        os << "  \"compute\": [\n";
+        for (std::size_t i = 0; i < compute.size(); ++i) {
+            const auto& r = compute[i];
+            os << "    {\"kernel\": \"" << r.kernel << "\", \"width\": " << r.width << ", \"threads\": " << r.threads
+               << ", \"gflops\": " << r.gflops << "}" << (i + 1 < compute.size() ? "," : "") << "\n";
+        }
+        os << "  ],\n";
+        os << "  \"bandwidth\": [\n";
+        for (std::size_t i = 0; i < bandwidth.size(); ++i) {
+            const auto& r = bandwidth[i];
+            os << "    {\"level\": \"" << r.level << "\", \"bytes\": " << r.bytes << ", \"threads\": " << r.threads
+               << ", \"read_gbs\": " << r.read_gbs << ", \"write_gbs\": " << r.write_gbs
+               << ", \"triad_gbs\": " << r.triad_gbs << ", \"update_gbs\": " << r.update_gbs << "}" << (i + 1 < bandwidth.size() ? "," : "") << "\n";
+        }
+        os << "  ]\n";
+        os << "}\n";
+    }
+
+    /** Read a roofline written by write_json
+     *
+     * Returns an empty roofline if the text holds no rates.
+     */
+    static roofline read_json(std::istream& is) {
+        const std::string text((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+        auto number = [](const std::string& object, const char* key) {
+            return std::strtod(detail::json_value(object, key).c_str(), nullptr);
+        };
+
+        roofline roof;
+        for (const auto& object : detail::json_objects(text, "compute")) {
+            roof.compute.push_back({detail::json_value(object, "kernel"), std::size_t(number(object, "width")),
+                                    std::size_t(number(object, "threads")), number(object, "gflops")});
+        }
+        for (const auto& object : detail::json_objects(text, "bandwidth")) {
+            roof.bandwidth.push_back({detail::json_value(object, "level"), std::size_t(number(object, "bytes")),
+                                      std::size_t(number(object, "threads")), number(object, "read_gbs"),
+                                      number(object, "write_gbs"), number(object, "triad_gbs"),
+                                      number(object, "update_gbs")});
+        }
+        return roof;
+    }
+
+    /** Return if nothing was measured or read
+     */
+    bool empty() const noexcept { return compute.empty() and bandwidth.empty(); }
+};
+
+/** Write the roofline as JSON
+ */
+inline std::ostream& operator<<(std::ostream& os, const roofline& roof) {
+    roof.write_json(os);
+    return os;
+}
+
+} /* namespace xstd */
@@ -0,0 +1,163 @@
+/**
+ * \file       scratch_arena.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>  // std::max
+#include <cstddef>    // std::size_t, std::max_align_t
+#include <cstdint>    // std::uintptr_t
+#include <mutex>      // std::mutex, std::lock_guard
+#include <new>        // std::align_val_t
+#include <vector>     // std::vector
+
+namespace xstd {
+
+/** Grow-only arena for temporary buffers
+ *
+ * Hands out scratch memory by bumping an offset into a block
+ * which is kept for the lifetime of the arena.  When a request
+ * does not fit a new block at least as large as everything
+ * reserved so far is added.  Calling reset() at the start of
+ * each phase (ex. a time step) releases all scratch memory at
+ * once and consolidates the blocks into one, so after the first
+ * phase the same pages are reused without any new system
+ * allocations or page faults.
+ *
+ * Allocation is thread-safe.  Memory is never freed individually
+ * and reset() must not be called while scratch memory is in use.
+ *
+ * \code{.cpp}
+ * xstd::scratch_arena arena;
+ * for (int step = 0; step < nsteps; ++step) {
+ *     arena.reset();
+ *     xstd::sort(std::execution::par, x.begin(), x.end(), arena);
+ * }
+ * \endcode
+ */
+class scratch_arena {
+   public:
+    /// Alignment of every block (one cache line)
+    static constexpr std::size_t block_alignment = 64;
+
+    /** Construct arena reserving bytes up front
+     */
+    explicit scratch_arena(const std::size_t bytes = 0) {
+        if (bytes > 0) {
+            this->add_block(bytes);
+        }
+    }
+
+    scratch_arena(const scratch_arena&) = delete;
+
+    scratch_arena& operator=(const scratch_arena&) = delete;
+
+    ~scratch_arena() { this->release(); }
+
+    /** Scratch memory of bytes aligned to alignment
+     */
+    void* allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        void* ptr = this->bump(bytes, alignment);
+        if (ptr == nullptr) {
+            this->add_block(std::max(bytes + alignment, capacity_));
+            ptr = this->bump(bytes, alignment);
+        }
+        return ptr;
+    }
+
+    /** Scratch memory for n uninitialized values of type T
+     */
+    template <typename T>
+    T* allocate(const std::size_t n) {
+        return static_cast<T*>(this->allocate(n * sizeof(T), std::max(alignof(T), block_alignment)));
+    }
+
+    /** Release all scratch memory for reuse
+     *
+     * Multiple blocks are replaced by a single block holding
+     * the total capacity so the next phase fits in one block.
+     */
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (blocks_.size() > 1) {
+            const auto total = capacity_;
+            this->release();
+            this->add_block(total);
+        }
+        offset_ = 0;
+        used_   = 0;
+    }
+
+    /** Total bytes reserved from the system
+     */
+    std::size_t capacity() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return capacity_;
+    }
+
+    /** Bytes handed out since the last reset
+     */
+    std::size_t used() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return used_;
+    }
+
+    /** Number of blocks requested from the system so far
+     */
+    std::size_t system_allocations() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return system_allocations_;
+    }
+
+   private:
+    struct block {
+        char* data;
+        std::size_t size;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<block> blocks_;  // Last block is the current one
+    std::size_t offset_             = 0;
+    std::size_t used_               = 0;
+    std::size_t capacity_           = 0;
+    std::size_t system_allocations_ = 0;
+
+    void* bump(const std::size_t bytes, const std::size_t alignment) {
+        if (blocks_.empty()) {
+            return nullptr;
+        }
+        const auto& current = blocks_.back();
+        const auto base     = reinterpret_cast<std::uintptr_t>(current.data);
+        const auto first    = ((base + offset_ + alignment - 1) / alignment) * alignment;
+        const auto last     = first + bytes;
+        if (last > base + current.size) {
+            return nullptr;
+        }
+        used_ += last - (base + offset_);
+        offset_ = last - base;
+        return reinterpret_cast<void*>(first);
+    }
+
+    void add_block(const std::size_t bytes) {
+        if (blocks_.size() == blocks_.capacity()) {
+            blocks_.reserve(2 * blocks_.size() + 1);  // So push_back cannot throw and leak the block
+        }
+        auto data = static_cast<char*>(::operator new(bytes, std::align_val_t(block_alignment)));
+        blocks_.push_back({data, bytes});
+        offset_ = 0;
+        capacity_ += bytes;
+        ++system_allocations_;
+    }
+
+    void release() noexcept {
+        for (auto& b : blocks_) {
+            ::operator delete(b.data, std::align_val_t(block_alignment));
+        }
+        blocks_.clear();
+        capacity_ = 0;
+    }
+};
+
+} /* namespace xstd */
@@ -0,0 +1,433 @@
+/**
+ * \file       simd.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <cstddef>      // std::size_t, std::ptrdiff_t
+#include <cstdint>      // std::uintptr_t
+#include <cstring>      // std::memcpy
+#include <type_traits>  // std::is_same_v
+
+#if defined(__AVX512F__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define XSTD_SIMD_VECTOR_EXTENSIONS 1
+#else
+#define XSTD_SIMD_VECTOR_EXTENSIONS 0
+#endif
+
+namespace xstd {
+namespace detail {
+
+/** Width in bytes of the widest vector registers enabled at compile time
+ */
+#if defined(__AVX512F__)
+inline constexpr std::size_t native_simd_bytes = 64;
+#elif defined(__AVX__)
+inline constexpr std::size_t native_simd_bytes = 32;
+#else
+inline constexpr std::size_t native_simd_bytes = 16;
+#endif
+
+#if XSTD_SIMD_VECTOR_EXTENSIONS
+template <typename T, std::size_t Bytes>
+struct simd_storage {
+    typedef T type __attribute__((vector_size(Bytes)));
+};
+#else
+template <typename T, std::size_t Bytes>
+struct simd_storage {
+    struct type {
+        T lane[Bytes / sizeof(T)];
+        T& operator[](const std::size_t i) { return lane[i]; }
+        const T& operator[](const std::size_t i) const { return lane[i]; }
+    };
+};
+#endif
+
+} /* namespace detail */
+
+/** Fixed width pack of values held in a vector register
+ *
+ * Thin wrapper around the compiler vector extensions (GCC, Clang
+ * and NVHPC) so kernels can be written with explicit vector
+ * operations independent of the auto-vectorizer.  The partial
+ * load and store functions provide masked access for the
+ * remainder of a loop and use the AVX/AVX-512 masked instructions
+ * when they are enabled at compile time.
+ *
+ * \tparam T Arithmetic type of each lane
+ * \tparam Bytes Width of the pack in bytes
+ *
+ * \code{.cpp}
+ * using pack = xstd::simd_pack<double>;
+ * std::size_t i = 0;
+ * for (; i + pack::size <= n; i += pack::size) {
+ *     (pack::broadcast(a) * pack::load(x + i) + pack::load(y + i)).store(y + i);
+ * }
+ * (pack::broadcast(a) * pack::load_partial(x + i, n - i) + pack::load_partial(y + i, n - i))
+ *     .store_partial(y + i, n - i);
+ * \endcode
+ */
+template <typename T, std::size_t Bytes = detail::native_simd_bytes>
+struct simd_pack {
+    // ====================================================
+    // Types
+    // ====================================================
+
+    using value_type  = T;
+    using native_type = typename detail::simd_storage<T, Bytes>::type;
+
+    static constexpr std::size_t size      = Bytes / sizeof(T);
+    static constexpr std::size_t alignment = Bytes;
+
+    static_assert(size > 0 and Bytes % sizeof(T) == 0, "Pack width must be a multiple of value size");
+
+    /// If gather uses vector gather instructions (else one load per lane)
+    static constexpr bool hardware_gather =
+#if defined(__AVX512F__)
+        (Bytes == 64 and (std::is_same_v<T, double> or std::is_same_v<T, float>)) or
+#endif
+#if defined(__AVX2__)
+        (Bytes == 32 and (std::is_same_v<T, double> or std::is_same_v<T, float>)) or
+#endif
+        false;
+
+    /// If scatter uses vector scatter instructions (else one store per lane)
+    static constexpr bool hardware_scatter =
+#if defined(__AVX512F__)
+        (Bytes == 64 and (std::is_same_v<T, double> or std::is_same_v<T, float>)) or
+#endif
+        false;
+
+    // ====================================================
+    // Construction
+    // ====================================================
+
+    /** All lanes set to value
+     */
+    static simd_pack broadcast(const T value) noexcept {
+        simd_pack result;
+        for (std::size_t i = 0; i < size; ++i) {
+            result.data[i] = value;
+        }
+        return result;
+    }
+
+    /** Load from unaligned memory
+     */
+    static simd_pack load(const T* ptr) noexcept {
+        simd_pack result;
+        std::memcpy(&result.data, ptr, Bytes);
+        return result;
+    }
+
+    /** Load from memory aligned to Bytes
+     */
+    static simd_pack load_aligned(const T* ptr) noexcept {
+        simd_pack result;
+        result.data = *reinterpret_cast<const native_type*>(ptr);
+        return result;
+    }
+
+    /** Load first n lanes (n < size) with remaining lanes zero
+     */
+    static simd_pack load_partial(const T* ptr, const std::size_t n) noexcept {
+        simd_pack result;
+#if defined(__AVX512F__)
+        if constexpr (Bytes == 64 and std::is_same_v<T, double>) {
+            result.data = _mm512_maskz_loadu_pd(lane_mask16_(n), ptr);
+            return result;
+        } else if constexpr (Bytes == 64 and std::is_same_v<T, float>) {
+            result.data = _mm512_maskz_loadu_ps(lane_mask16_(n), ptr);
+            return result;
+        }
+#endif
+#if defined(__AVX__)
+        if constexpr (Bytes == 32 and std::is_same_v<T, double>) {
+            result.data = _mm256_maskload_pd(ptr, lane_mask256_(n));
+            return result;
+        } else if constexpr (Bytes == 32 and std::is_same_v<T, float>) {
+            result.data = _mm256_maskload_ps(ptr, lane_mask256_(n));
+            return result;
+        }
+#endif
+        result = broadcast(T(0));
+        for (std::size_t i = 0; i < n; ++i) {
+            result.data[i] = ptr[i];
+        }
+        return result;
+    }
+
+    /** Load lanes from memory separated by stride
+     *
+     * Uses the AVX2/AVX-512 gather instructions when enabled
+     * (see hardware_gather) and one scalar load per lane otherwise.
+     */
+    static simd_pack gather(const T* ptr, const std::ptrdiff_t stride) noexcept {
+        simd_pack result;
+        if (index_fits_(stride)) {
+#if defined(__AVX512F__)
+            if constexpr (Bytes == 64 and std::is_same_v<T, double>) {
+                result.data = _mm512_i32gather_pd(lane_index256_(stride), ptr, 8);
+                return result;
+            } else if constexpr (Bytes == 64 and std::is_same_v<T, float>) {
+                result.data = _mm512_i32gather_ps(lane_index512_(stride), ptr, 4);
+                return result;
+            }
+#endif
+#if defined(__AVX2__)
+            if constexpr (Bytes == 32 and std::is_same_v<T, double>) {
+                result.data = _mm256_i32gather_pd(ptr, lane_index128_(stride), 8);
+                return result;
+            } else if constexpr (Bytes == 32 and std::is_same_v<T, float>) {
+                result.data = _mm256_i32gather_ps(ptr, lane_index256_(stride), 4);
+                return result;
+            }
+#endif
+        }
+        for (std::size_t i = 0; i < size; ++i) {
+            result.data[i] = ptr[static_cast<std::ptrdiff_t>(i) * stride];
+        }
+        return result;
+    }
+
+    /** Load first n lanes separated by stride with remaining lanes zero
+     */
+    static simd_pack gather_partial(const T* ptr, const std::ptrdiff_t stride, const std::size_t n) noexcept {
+        simd_pack result = broadcast(T(0));
+        if (index_fits_(stride)) {
+#if defined(__AVX512F__)
+            if constexpr (Bytes == 64 and std::is_same_v<T, double>) {
+                result.data = _mm512_mask_i32gather_pd(result.data, lane_mask16_(n), lane_index256_(stride), ptr, 8);
+                return result;
+            } else if constexpr (Bytes == 64 and std::is_same_v<T, float>) {
+                result.data = _mm512_mask_i32gather_ps(result.data, lane_mask16_(n), lane_index512_(stride), ptr, 4);
+                return result;
+            }
+#endif
+#if defined(__AVX2__)
+            if constexpr (Bytes == 32 and std::is_same_v<T, double>) {
+                result.data = _mm256_mask_i32gather_pd(result.data, ptr, lane_index128_(stride),
+                                                       _mm256_castsi256_pd(lane_mask256_(n)), 8);
+                return result;
+            } else if constexpr (Bytes == 32 and std::is_same_v<T, float>) {
+                result.data = _mm256_mask_i32gather_ps(result.data, ptr, lane_index256_(stride),
+                                                       _mm256_castsi256_ps(lane_mask256_(n)), 4);
+                return result;
+            }
+#endif
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            result.data[i] = ptr[static_cast<std::ptrdiff_t>(i) * stride];
+        }
+        return result;
+    }
+
+    // ====================================================
+    // Storage
+    // ====================================================
+
+    /** Store to unaligned memory
+     */
+    void store(T* ptr) const noexcept { std::memcpy(ptr, &data, Bytes); }
+
+    /** Store to memory aligned to Bytes
+     */
+    void store_aligned(T* ptr) const noexcept { *reinterpret_cast<native_type*>(ptr) = data; }
+
+    /** Store first n lanes (n < size) leaving remaining memory untouched
+     */
+    void store_partial(T* ptr, const std::size_t n) const noexcept {
+#if defined(__AVX512F__)
+        if constexpr (Bytes == 64 and std::is_same_v<T, double>) {
+            _mm512_mask_storeu_pd(ptr, lane_mask16_(n), data);
+            return;
+        } else if constexpr (Bytes == 64 and std::is_same_v<T, float>) {
+            _mm512_mask_storeu_ps(ptr, lane_mask16_(n), data);
+            return;
+        }
+#endif
+#if defined(__AVX__)
+        if constexpr (Bytes == 32 and std::is_same_v<T, double>) {
+            _mm256_maskstore_pd(ptr, lane_mask256_(n), data);
+            return;
+        } else if constexpr (Bytes == 32 and std::is_same_v<T, float>) {
+            _mm256_maskstore_ps(ptr, lane_mask256_(n), data);
+            return;
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            ptr[i] = data[i];
+        }
+    }
+
+    /** Store lanes to memory separated by stride
+     *
+     * Uses the AVX-512 scatter instructions when enabled (see
+     * hardware_scatter) and one scalar store per lane otherwise.
+     */
+    void scatter(T* ptr, const std::ptrdiff_t stride) const noexcept {
+#if defined(__AVX512F__)
+        if (index_fits_(stride)) {
+            if constexpr (Bytes == 64 and std::is_same_v<T, double>) {
+                _mm512_i32scatter_pd(ptr, lane_index256_(stride), data, 8);
+                return;
+            } else if constexpr (Bytes == 64 and std::is_same_v<T, float>) {
+                _mm512_i32scatter_ps(ptr, lane_index512_(stride), data, 4);
+                return;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < size; ++i) {
+            ptr[static_cast<std::ptrdiff_t>(i) * stride] = data[i];
+        }
+    }
+
+    /** Store first n lanes to memory separated by stride
+     */
+    void scatter_partial(T* ptr, const std::ptrdiff_t stride, const std::size_t n) const noexcept {
+#if defined(__AVX512F__)
+        if (index_fits_(stride)) {
+            if constexpr (Bytes == 64 and std::is_same_v<T, double>) {
+                _mm512_mask_i32scatter_pd(ptr, lane_mask16_(n), lane_index256_(stride), data, 8);
+                return;
+            } else if constexpr (Bytes == 64 and std::is_same_v<T, float>) {
+                _mm512_mask_i32scatter_ps(ptr, lane_mask16_(n), lane_index512_(stride), data, 4);
+                return;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            ptr[static_cast<std::ptrdiff_t>(i) * stride] = data[i];
+        }
+    }
+
+    // ====================================================
+    // Operators
+    // ====================================================
+
+    T operator[](const std::size_t i) const noexcept { return data[i]; }
+
+    simd_pack& operator+=(const simd_pack& other) noexcept {
+#if XSTD_SIMD_VECTOR_EXTENSIONS
+        data += other.data;
+#else
+        for (std::size_t i = 0; i < size; ++i) data[i] += other.data[i];
+#endif
+        return *this;
+    }
+
+    simd_pack& operator-=(const simd_pack& other) noexcept {
+#if XSTD_SIMD_VECTOR_EXTENSIONS
+        data -= other.data;
+#else
+        for (std::size_t i = 0; i < size; ++i) data[i] -= other.data[i];
+#endif
+        return *this;
+    }
+
+    simd_pack& operator*=(const simd_pack& other) noexcept {
+#if XSTD_SIMD_VECTOR_EXTENSIONS
+        data *= other.data;
+#else
+        for (std::size_t i = 0; i < size; ++i) data[i] *= other.data[i];
+#endif
+        return *this;
+    }
+
+    simd_pack& operator/=(const simd_pack& other) noexcept {
+#if XSTD_SIMD_VECTOR_EXTENSIONS
+        data /= other.data;
+#else
+        for (std::size_t i = 0; i < size; ++i) data[i] /= other.data[i];
+#endif
+        return *this;
+    }
+
+    friend simd_pack operator+(simd_pack x, const simd_pack& y) noexcept { return x += y; }
+
+    friend simd_pack operator-(simd_pack x, const simd_pack& y) noexcept { return x -= y; }
+
+    friend simd_pack operator*(simd_pack x, const simd_pack& y) noexcept { return x *= y; }
+
+    friend simd_pack operator/(simd_pack x, const simd_pack& y) noexcept { return x /= y; }
+
+    native_type data;
+
+   private:
+    /** If the lane offsets of stride fit the 32-bit gather indices
+     */
+    static bool index_fits_(const std::ptrdiff_t stride) noexcept {
+        constexpr std::ptrdiff_t max_index = 0x7FFFFFFF;
+        return (stride <= max_index / std::ptrdiff_t(size)) and (stride >= -max_index / std::ptrdiff_t(size));
+    }
+
+#if defined(__AVX2__)
+    static __m128i lane_index128_(const std::ptrdiff_t stride) noexcept {
+        return _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(static_cast<int>(stride)));
+    }
+    static __m256i lane_index256_(const std::ptrdiff_t stride) noexcept {
+        return _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(stride)));
+    }
+#endif
+#if defined(__AVX512F__)
+    static __m512i lane_index512_(const std::ptrdiff_t stride) noexcept {
+        return _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                  _mm512_set1_epi32(static_cast<int>(stride)));
+    }
+#endif
+#if defined(__AVX512F__)
+    static __mmask16 lane_mask16_(const std::size_t n) noexcept {
+        return static_cast<__mmask16>((1u << n) - 1u);
+    }
+#endif
+#if defined(__AVX__)
+    static __m256i lane_mask256_(const std::size_t n) noexcept {
+        if constexpr (sizeof(T) == 8) {
+            const auto idx = _mm256_set_pd(3, 2, 1, 0);
+            return _mm256_castpd_si256(_mm256_cmp_pd(idx, _mm256_set1_pd(double(n)), _CMP_LT_OQ));
+        } else {
+            const auto idx = _mm256_set_ps(7, 6, 5, 4, 3, 2, 1, 0);
+            return _mm256_castps_si256(_mm256_cmp_ps(idx, _mm256_set1_ps(float(n)), _CMP_LT_OQ));
+        }
+    }
+#endif
+};
+
+/** Number of leading elements to process before ptr is aligned to Alignment
+ *
+ * Returns the size of the scalar peel loop needed before the
+ * main vector loop can use aligned loads and stores.  If ptr
+ * can never become aligned the full length n is returned.
+ */
+template <std::size_t Alignment, typename T>
+std::size_t simd_peel(const T* ptr, const std::size_t n) noexcept {
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    if (address % sizeof(T) != 0) {
+        return n;
+    }
+    const auto misalign = address % Alignment;
+    const auto peel     = misalign == 0 ? 0 : (Alignment - misalign) / sizeof(T);
+    return peel < n ? peel : n;
+}
+
+namespace execution {
+
+/** Execution policy tag selecting hand vectorized kernels
+ *
+ * Not a standard execution policy.  Benchmarks provide an
+ * overload taking this tag which implements the kernel with
+ * xstd::simd_pack so the speed of explicit vectorization can
+ * be compared against each std::execution policy.
+ */
+struct simd_policy {};
+
+inline constexpr simd_policy simd{};
+
+} /* namespace execution */
+} /* namespace xstd */
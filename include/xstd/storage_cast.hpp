@@ -0,0 +1,244 @@
+/**
+ * \file       storage_cast.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <cstddef>      // std::size_t, std::ptrdiff_t
+#include <cstdint>      // std::uint16_t, std::uint32_t
+#include <cstring>      // std::memcpy
+#include <iterator>     // std::iterator_traits, std::begin, std::end
+#include <type_traits>  // std::conditional_t, std::is_const_v, std::is_lvalue_reference_v
+
+namespace xstd {
+
+/** Brain floating point number (bfloat16)
+ *
+ * The upper 16 bits of an IEEE float: the same exponent range
+ * as float with 8 bits of precision.  Converting from float
+ * rounds to nearest even and keeps NaN.  The conversions only
+ * use integer operations without branches so loops converting
+ * arrays vectorize.
+ */
+struct bfloat16 {
+    std::uint16_t bits = 0;
+
+    bfloat16() = default;
+
+    explicit bfloat16(const float value) noexcept : bits(round(value)) {}
+
+    explicit bfloat16(const double value) noexcept : bits(round(static_cast<float>(value))) {}
+
+    operator float() const noexcept {
+        const std::uint32_t u = std::uint32_t(bits) << 16;
+        float value;
+        std::memcpy(&value, &u, sizeof(value));
+        return value;
+    }
+
+    static bfloat16 from_bits(const std::uint16_t bits) noexcept {
+        bfloat16 value;
+        value.bits = bits;
+        return value;
+    }
+
+   private:
+    static std::uint16_t round(const float value) noexcept {
+        std::uint32_t u;
+        std::memcpy(&u, &value, sizeof(u));
+        const std::uint32_t rounded = u + 0x7FFFu + ((u >> 16) & 1u);
+        const bool nan              = (u & 0x7FFFFFFFu) > 0x7F800000u;
+        return static_cast<std::uint16_t>(nan ? ((u >> 16) | 0x0040u) : (rounded >> 16));
+    }
+};
+
+/** Reference to a stored value which reads and writes as Compute
+ *
+ * Returned by the storage_iterator of writable storage.  Reading
+ * converts the stored value to Compute and assigning converts
+ * the Compute value back to the storage type.  All operations
+ * are const (like a reference) so the proxy also works through
+ * adaptors which return const references (ex. strided_iterator).
+ *
+ * \tparam Storage Type of the stored value
+ * \tparam Compute Type exposed to the algorithms
+ */
+template <typename Storage, typename Compute>
+class storage_reference {
+   public:
+    explicit storage_reference(Storage& value) noexcept : value_(value) {}
+
+    storage_reference(const storage_reference&) = default;
+
+    operator Compute() const noexcept { return static_cast<Compute>(value_); }
+
+    Compute get() const noexcept { return static_cast<Compute>(value_); }
+
+    const storage_reference& operator=(const Compute value) const noexcept {
+        value_ = static_cast<Storage>(value);
+        return *this;
+    }
+
+    const storage_reference& operator=(const storage_reference& other) const noexcept {
+        return *this = other.get();
+    }
+
+    const storage_reference& operator+=(const Compute value) const noexcept { return *this = this->get() + value; }
+
+    const storage_reference& operator-=(const Compute value) const noexcept { return *this = this->get() - value; }
+
+    const storage_reference& operator*=(const Compute value) const noexcept { return *this = this->get() * value; }
+
+    const storage_reference& operator/=(const Compute value) const noexcept { return *this = this->get() / value; }
+
+   private:
+    Storage& value_;
+};
+
+/** Iterator converting the values of another iterator to Compute
+ *
+ * Dereferencing returns a storage_reference which converts on
+ * read and write when the wrapped iterator refers to writable
+ * values and a Compute value otherwise.  The conversion happens
+ * inside the algorithm loop so values are widened in registers
+ * without a copy pass and the loops vectorize under the unseq
+ * policies when the conversion does.
+ *
+ * \tparam Iterator Iterator over the stored values
+ * \tparam Compute Type exposed to the algorithms
+ */
+template <typename Iterator, typename Compute>
+class storage_iterator {
+    using base_reference = typename std::iterator_traits<Iterator>::reference;
+    using storage_type   = std::remove_reference_t<base_reference>;
+
+   public:
+    static constexpr bool writable = std::is_lvalue_reference_v<base_reference> and
+                                     not std::is_const_v<storage_type>;
+
+    using iterator_category = typename std::iterator_traits<Iterator>::iterator_category;
+    using difference_type   = typename std::iterator_traits<Iterator>::difference_type;
+    using value_type        = Compute;
+    using pointer           = void;
+    using reference = std::conditional_t<writable, storage_reference<storage_type, Compute>, Compute>;
+
+    storage_iterator() = default;
+
+    explicit storage_iterator(Iterator iterator) : iterator_(iterator) {}
+
+    /// Wrapped iterator over the stored values
+    Iterator base() const { return iterator_; }
+
+    reference operator*() const { return reference(*iterator_); }
+
+    reference operator[](const difference_type n) const { return reference(iterator_[n]); }
+
+    storage_iterator& operator++() {
+        ++iterator_;
+        return *this;
+    }
+
+    storage_iterator operator++(int) {
+        auto tmp = *this;
+        ++iterator_;
+        return tmp;
+    }
+
+    storage_iterator& operator--() {
+        --iterator_;
+        return *this;
+    }
+
+    storage_iterator operator--(int) {
+        auto tmp = *this;
+        --iterator_;
+        return tmp;
+    }
+
+    storage_iterator& operator+=(const difference_type n) {
+        iterator_ += n;
+        return *this;
+    }
+
+    storage_iterator& operator-=(const difference_type n) {
+        iterator_ -= n;
+        return *this;
+    }
+
+    friend storage_iterator operator+(storage_iterator x, const difference_type n) { return x += n; }
+
+    friend storage_iterator operator+(const difference_type n, storage_iterator x) { return x += n; }
+
+    friend storage_iterator operator-(storage_iterator x, const difference_type n) { return x -= n; }
+
+    friend difference_type operator-(const storage_iterator& x, const storage_iterator& y) {
+        return x.iterator_ - y.iterator_;
+    }
+
+    friend bool operator==(const storage_iterator& x, const storage_iterator& y) { return x.iterator_ == y.iterator_; }
+
+    friend bool operator!=(const storage_iterator& x, const storage_iterator& y) { return x.iterator_ != y.iterator_; }
+
+    friend bool operator<(const storage_iterator& x, const storage_iterator& y) { return x.iterator_ < y.iterator_; }
+
+    friend bool operator>(const storage_iterator& x, const storage_iterator& y) { return x.iterator_ > y.iterator_; }
+
+    friend bool operator<=(const storage_iterator& x, const storage_iterator& y) { return x.iterator_ <= y.iterator_; }
+
+    friend bool operator>=(const storage_iterator& x, const storage_iterator& y) { return x.iterator_ >= y.iterator_; }
+
+   private:
+    Iterator iterator_;
+};
+
+/** Proxy returned by storage_cast function
+ *
+ * Implements the begin() and end() methods so the view can be
+ * used by range based for loops and passed to xstd::zip and
+ * xstd::strided like a container.
+ */
+template <typename Iterator, typename Compute>
+struct storage_proxy {
+    using iterator = storage_iterator<Iterator, Compute>;
+
+    storage_proxy(Iterator first, Iterator last) : first_(first), last_(last) {}
+
+    iterator begin() const { return iterator(first_); }
+
+    iterator end() const { return iterator(last_); }
+
+    std::size_t size() const { return static_cast<std::size_t>(std::distance(first_, last_)); }
+
+   private:
+    Iterator first_;
+    Iterator last_;
+};
+
+/** View of stored values as Compute values
+ *
+ * Values are converted to Compute when read and back to the
+ * storage type when written so fields can be kept in float or
+ * bfloat16 while the arithmetic is done in double.
+ *
+ * \code{.cpp}
+ * std::vector<float> x(N), y(N);
+ * auto wx = xstd::storage_cast<double>(x);
+ * auto wy = xstd::storage_cast<double>(y);
+ * std::transform(std::execution::par_unseq, wx.begin(), wx.end(), wy.begin(), wy.begin(),
+ *                [a](double xval, double yval) { return yval + a * xval; });
+ * \endcode
+ */
+template <typename Compute, typename Iterator>
+storage_proxy<Iterator, Compute> storage_cast(Iterator first, Iterator last) {
+    return {first, last};
+}
+
+/** View of the values of a container as Compute values
+ */
+template <typename Compute, typename Container>
+auto storage_cast(Container& container) {
+    return storage_cast<Compute>(std::begin(container), std::end(container));
+}
+
+} /* namespace xstd */
@@ -0,0 +1,182 @@
+/**
+ * \file       stream.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::transform, std::min, std::max
+#include <cstddef>      // std::size_t
+#include <filesystem>   // std::filesystem::file_size
+#include <functional>   // std::plus
+#include <numeric>      // std::reduce, std::transform_reduce
+#include <string>       // std::string
+#include <type_traits>  // std::invoke_result_t, std::decay_t, std::is_trivially_copyable_v
+#include <vector>       // std::vector
+
+#include "xstd/binary_file.hpp"
+#include "xstd/pipeline.hpp"
+#include "xstd/range.hpp"
+#include "xstd/uninitialized.hpp"
+
+namespace xstd {
+
+/** Chunked streaming of a binary file through parallel algorithms
+ *
+ * Processes a file of raw values of type T (as written by
+ * xstd::mmap_array) which may be much larger than memory.  The
+ * file is read in large chunks on an I/O thread while earlier
+ * chunks are transformed or reduced with an execution policy
+ * and (for transform) the results of even earlier chunks are
+ * written on the calling thread.  The stages are connected by
+ * an xstd::pipeline with a ring of buffers per stage so disk
+ * and cores are kept busy at the same time while memory stays
+ * bounded by buffers * chunk size.
+ *
+ * Failures to read or write throw std::ios_base::failure.
+ *
+ * \tparam T Type of value stored in the file (trivially copyable)
+ *
+ * \code{.cpp}
+ * xstd::stream<double> field("field.bin");
+ * field.transform(std::execution::par, "scaled.bin", [](double x) { return 2.0 * x; });
+ * double sum = field.reduce(std::execution::par);
+ * \endcode
+ */
+template <typename T>
+class stream {
+    static_assert(std::is_trivially_copyable_v<T>, "Streamed type must be trivially copyable");
+
+   public:
+    using value_type = T;
+
+    /// Size of a chunk when none is provided
+    static constexpr std::size_t default_chunk_bytes = std::size_t(16) * 1024 * 1024;
+
+    /// Default number of chunks in flight (read, compute and write)
+    static constexpr std::size_t default_buffers = 3;
+
+    /** Construct the stream
+     *
+     * \param path[in] Path of the file to stream
+     * \param chunk_size[in] Number of values per chunk (0 selects 16 MB chunks)
+     * \param buffers[in] Number of chunks in flight (1 runs the stages one after the other)
+     */
+    explicit stream(const std::string& path, const std::size_t chunk_size = 0,
+                    const std::size_t buffers = default_buffers)
+        : path_(path),
+          size_(std::filesystem::file_size(path) / sizeof(T)),
+          chunk_(chunk_size > 0 ? chunk_size : std::max<std::size_t>(default_chunk_bytes / sizeof(T), 1)),
+          buffers_(std::max<std::size_t>(buffers, 1)) {}
+
+    /** Number of values in the file
+     */
+    std::size_t size() const noexcept { return size_; }
+
+    /** Number of values per chunk
+     */
+    std::size_t chunk_size() const noexcept { return chunk_; }
+
+    /** Number of chunks in flight
+     */
+    std::size_t buffers() const noexcept { return buffers_; }
+
+    /** Apply op to every value writing the results to output
+     *
+     * \param policy[in] Execution policy used within each chunk
+     * \param output[in] Path of the file to write (must differ from the input)
+     * \param op[in] Unary operation returning the value to write
+     */
+    template <typename Policy, typename UnaryOp>
+    void transform(Policy&& policy, const std::string& output, UnaryOp op) const {
+        using result_type = std::decay_t<std::invoke_result_t<UnaryOp&, const T&>>;
+        static_assert(std::is_trivially_copyable_v<result_type>, "Written type must be trivially copyable");
+
+        auto out_file = detail::open_output(output);
+        auto in       = this->make_buffers<T>();
+        auto out      = this->make_buffers<result_type>();
+        auto compute  = [&](auto first, auto) {
+            const auto k = *first;
+            auto& src    = in[k % buffers_];
+            std::transform(policy, src.begin(), src.begin() + this->count(k), out[k % buffers_].begin(), op);
+        };
+        auto write = [&](auto first, auto) {
+            const auto k     = *first;
+            const auto bytes = this->count(k) * sizeof(result_type);
+            out_file.write(reinterpret_cast<const char*>(out[k % buffers_].data()), bytes);
+        };
+        this->run(in, compute, write);
+    }
+
+    /** Reduce all values with op starting from init
+     *
+     * \param policy[in] Execution policy used within each chunk
+     * \param init[in] Initial value
+     * \param op[in] Binary associative and commutative operation
+     */
+    template <typename Policy, typename U, typename BinaryOp>
+    U reduce(Policy&& policy, U init, BinaryOp op) const {
+        return this->transform_reduce(policy, init, op, [](const T& x) { return x; });
+    }
+
+    /** Sum of all values
+     */
+    template <typename Policy>
+    T reduce(Policy&& policy) const {
+        return this->reduce(policy, T(), std::plus<>());
+    }
+
+    /** Reduce the transformed values with reduce_op starting from init
+     *
+     * \param policy[in] Execution policy used within each chunk
+     * \param init[in] Initial value
+     * \param reduce_op[in] Binary associative and commutative operation
+     * \param transform_op[in] Unary operation applied to every value
+     */
+    template <typename Policy, typename U, typename BinaryOp, typename UnaryOp>
+    U transform_reduce(Policy&& policy, U init, BinaryOp reduce_op, UnaryOp transform_op) const {
+        auto in      = this->make_buffers<T>();
+        auto compute = [&](auto first, auto) {
+            const auto k     = *first;
+            const auto& src  = in[k % buffers_];
+            const auto chunk = std::transform_reduce(policy, src.begin() + 1, src.begin() + this->count(k),
+                                                     U(transform_op(src[0])), reduce_op, transform_op);
+            init             = reduce_op(init, chunk);
+        };
+        this->run(in, compute);
+        return init;
+    }
+
+   private:
+    std::string path_;
+    std::size_t size_;
+    std::size_t chunk_;
+    std::size_t buffers_;
+
+    std::size_t nchunks() const noexcept { return (size_ + chunk_ - 1) / chunk_; }
+
+    std::size_t count(const std::size_t k) const noexcept { return std::min(chunk_, size_ - k * chunk_); }
+
+    template <typename U>
+    std::vector<uninitialized_vector<U>> make_buffers() const {
+        std::vector<uninitialized_vector<U>> buffers;
+        for (std::size_t i = 0; i < std::min(buffers_, this->nchunks()); ++i) {
+            buffers.emplace_back(chunk_);
+        }
+        return buffers;
+    }
+
+    /** Read every chunk into the input buffers ahead of the stages
+     */
+    template <typename... Stages>
+    void run(std::vector<uninitialized_vector<T>>& in, Stages&&... stages) const {
+        auto in_file = detail::open_input(path_);
+        auto read    = [&](auto first, auto) {
+            const auto k = *first;
+            in_file.read(reinterpret_cast<char*>(in[k % buffers_].data()), this->count(k) * sizeof(T));
+        };
+        xstd::pipeline(1, buffers_).run(xstd::range(this->nchunks()), read, stages...);
+    }
+};
+
+} /* namespace xstd */
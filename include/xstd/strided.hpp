@@ -7,7 +7,7 @@
 
 #include <cassert>   // assert
 #include <cstddef>   // std::size_t, std::ptrdiff_t;
-#include <iterator>  // std::random_access_iterator_tag
+#include <iterator>  // std::random_access_iterator_tag, std::next, std::distance
 #include <utility>   // std::declval
 
 namespace xstd {
@@ -50,21 +50,19 @@ struct strided_iterator {
     // Constructors
     // ====================================================
 
+    strided_iterator() : iterator_(), stride_(1) {}
+
     strided_iterator(Iterator iterator, const difference_type stride) : iterator_(iterator), stride_(stride) {
         assert(stride != 0);
     }
 
-    strided_iterator(const strided_iterator<Iterator>& other) : iterator_(other.iterator_), stride_(other.stride_) {}
+    strided_iterator(const strided_iterator& other) = default;
 
     // ====================================================
     // Operators
     // ====================================================
 
-    strided_iterator& operator=(strided_iterator other) {
-        assert(stride_ == other.stride_);
-        std::swap(iterator_, other.iterator_);
-        return *this;
-    }
+    strided_iterator& operator=(const strided_iterator& other) = default;
 
     strided_iterator& operator++() {
         std::advance(iterator_, stride_);
@@ -98,20 +96,12 @@ struct strided_iterator {
         return *this;
     }
 
-    reference operator[](const difference_type n) {
-        auto tmp = iterator_;
-        std::advance(tmp, n * stride_);
-        return *tmp;
-    }
+    reference operator[](const difference_type n) const { return *std::next(iterator_, n * stride_); }
 
-    const reference operator[](const difference_type n) const {
-        auto tmp = iterator_;
-        std::advance(tmp, n * stride_);
-        return *tmp;
-    }
+    reference operator*() const { return *iterator_; }
 
-    reference operator*() { return *iterator_; }
-    const reference operator*() const { return *iterator_; }
+    /// Wrapped iterator at the current position
+    Iterator base() const { return iterator_; }
 
     // ====================================================
     // Friend Operators
@@ -119,31 +109,33 @@ struct strided_iterator {
 
     friend bool operator==(const strided_iterator& x, const strided_iterator& y) {
         assert(x.stride_ == y.stride_);
-        return ((x - y) == 0);
+        return x.iterator_ == y.iterator_;
     }
 
-    friend bool operator!=(const strided_iterator& x, const strided_iterator& y) {
-        assert(x.stride_ == y.stride_);
-        return not(x == y);
-    }
+    friend bool operator!=(const strided_iterator& x, const strided_iterator& y) { return not(x == y); }
 
-    friend bool operator<(const strided_iterator& x, const strided_iterator& y) {
-        assert(x.stride_ == y.stride_);
-        return ((std::distance(x.iterator_, y.iterator_) / x.stride_) > 0);
-    }
+    friend bool operator<(const strided_iterator& x, const strided_iterator& y) { return (x - y) < 0; }
+
+    friend bool operator>(const strided_iterator& x, const strided_iterator& y) { return y < x; }
+
+    friend bool operator<=(const strided_iterator& x, const strided_iterator& y) { return not(y < x); }
+
+    friend bool operator>=(const strided_iterator& x, const strided_iterator& y) { return not(x < y); }
 
     friend difference_type operator-(const strided_iterator& x, const strided_iterator& y) {
         assert(x.stride_ == y.stride_);
         return (std::distance(y.iterator_, x.iterator_) / x.stride_);
     }
 
-    friend strided_iterator operator+(strided_iterator x, difference_type y) { return x += y; }
+    friend strided_iterator operator+(strided_iterator x, const difference_type y) { return x += y; }
+
+    friend strided_iterator operator+(const difference_type x, strided_iterator y) { return y += x; }
 
-    friend strided_iterator operator+(difference_type x, strided_iterator y) { return y += x; }
+    friend strided_iterator operator-(strided_iterator x, const difference_type y) { return x -= y; }
 
    private:
     Iterator iterator_;
-    const difference_type stride_;
+    difference_type stride_;
 };
 
 /**
@@ -167,8 +159,14 @@ struct strided_proxy {
 
     strided_proxy() = delete;
 
+    /** Construct the proxy
+     *
+     * The end is placed on the last whole stride within
+     * [first, last) so the end iterator is reached exactly
+     * and never advanced beyond last.
+     */
     strided_proxy(Iterator first, Iterator last, difference_type stride)
-        : first_(first), last_(last), stride_(stride) {}
+        : first_(first), last_(std::next(first, (std::distance(first, last) / stride) * stride)), stride_(stride) {}
 
     ~strided_proxy() = default;
 
@@ -0,0 +1,267 @@
+/**
+ * \file       traced.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::for_each, std::transform, std::sort, std::copy, std::fill
+#include <cstddef>      // std::size_t
+#include <execution>    // std::execution::*
+#include <functional>   // std::plus, std::less
+#include <iomanip>      // std::setw
+#include <iostream>     // std::cout
+#include <iterator>     // std::distance
+#include <map>          // std::map
+#include <mutex>        // std::mutex, std::lock_guard
+#include <numeric>      // std::reduce, std::transform_reduce, std::inclusive_scan
+#include <ostream>      // std::ostream
+#include <string>       // std::string
+#include <type_traits>  // std::is_void_v
+#include <utility>      // std::forward, std::move
+#include <vector>       // std::vector
+
+#include "xstd/stop_watch.hpp"
+
+namespace xstd {
+namespace execution {
+
+/** Execution policy carrying a region name
+ *
+ * Not a standard execution policy.  The xstd algorithm wrappers
+ * below accept it, run the std algorithm with the wrapped policy
+ * and add the time and number of elements of the call to the
+ * region's totals in the trace_registry.  The algorithms taking
+ * a scratch_arena and external_sort unwrap it the same way.
+ */
+template <typename Policy>
+struct traced_policy {
+    Policy policy;
+    std::string name;
+};
+
+/** Wrap a policy so algorithm calls are timed under name
+ *
+ * \code{.cpp}
+ * xstd::for_each(xstd::execution::traced(std::execution::par, "update"), x.begin(), x.end(), f);
+ * \endcode
+ */
+template <typename Policy>
+traced_policy<Policy> traced(const Policy policy, std::string name) {
+    return {policy, std::move(name)};
+}
+
+} /* namespace execution */
+
+/** Process wide totals of the traced regions
+ *
+ * Calls from any thread add to the totals of their region.  The
+ * report (regions sorted by total time) is printed when the
+ * process exits unless disabled.  Nested traced calls count
+ * toward both regions.
+ */
+class trace_registry final {
+   public:
+    /// Totals of one region
+    struct entry {
+        std::size_t calls    = 0;
+        std::size_t elements = 0;
+        double seconds       = 0;
+    };
+
+    using entry_map = std::map<std::string, entry>;
+
+    trace_registry(const trace_registry&)            = delete;
+    trace_registry& operator=(const trace_registry&) = delete;
+
+    ~trace_registry() {
+        if (print_at_exit_ and not entries_.empty()) {
+            this->report(std::cout);
+        }
+    }
+
+    /** The registry of the process
+     */
+    static trace_registry& instance() {
+        static trace_registry registry;
+        return registry;
+    }
+
+    /** Add one call to the totals of a region
+     */
+    void record(const std::string& name, const std::size_t elements, const double seconds) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& e = entries_[name];
+        e.calls += 1;
+        e.elements += elements;
+        e.seconds += seconds;
+    }
+
+    /** Copy of the totals of every region
+     */
+    entry_map entries() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_;
+    }
+
+    /** Remove all totals
+     */
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+    }
+
+    /** Set if the report is printed when the process exits
+     */
+    void print_at_exit(const bool print) noexcept { print_at_exit_ = print; }
+
+    /** Write the totals of each region sorted by total time
+     */
+    void report(std::ostream& os) const {
+        auto copy = this->entries();
+        std::vector<std::pair<std::string, entry>> sorted(copy.begin(), copy.end());
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const auto& a, const auto& b) { return a.second.seconds > b.second.seconds; });
+        double total = 0;
+        for (const auto& [name, e] : sorted) {
+            total += e.seconds;
+        }
+
+        const auto flags = os.flags();
+        os << "Traced Regions\n";
+        os << std::left << std::setw(24) << "  Name" << std::right << std::setw(10) << "Calls" << std::setw(14)
+           << "Elements" << std::setw(14) << "Total (sec)" << std::setw(14) << "Mean (sec)" << std::setw(14)
+           << "Elements/sec" << std::setw(10) << "Percent" << "\n";
+        for (const auto& [name, e] : sorted) {
+            os << "  " << std::left << std::setw(22) << name << std::right << std::setw(10) << e.calls
+               << std::setw(14) << e.elements << std::scientific << std::setprecision(3) << std::setw(14)
+               << e.seconds << std::setw(14) << e.seconds / e.calls << std::setw(14)
+               << (e.seconds > 0 ? e.elements / e.seconds : 0.0) << std::fixed << std::setprecision(1)
+               << std::setw(10) << (total > 0 ? 100.0 * e.seconds / total : 0.0) << "\n";
+        }
+        os.flags(flags);
+        os << std::flush;
+    }
+
+   private:
+    trace_registry() = default;
+
+    mutable std::mutex mutex_;
+    entry_map entries_;
+    bool print_at_exit_ = true;
+};
+
+namespace detail {
+
+/** Time function(policy) and record it under the policy's name
+ */
+template <typename Policy, typename Function>
+auto traced_call(const execution::traced_policy<Policy>& policy, const std::size_t elements, Function&& function) {
+    StopWatch watch;
+    watch.start();
+    if constexpr (std::is_void_v<decltype(function(policy.policy))>) {
+        function(policy.policy);
+        watch.stop();
+        trace_registry::instance().record(policy.name, elements, watch.elapsed_seconds());
+    } else {
+        auto result = function(policy.policy);
+        watch.stop();
+        trace_registry::instance().record(policy.name, elements, watch.elapsed_seconds());
+        return result;
+    }
+}
+
+template <typename Iterator>
+std::size_t traced_elements(Iterator first, Iterator last) {
+    return static_cast<std::size_t>(std::distance(first, last));
+}
+
+} /* namespace detail */
+
+// ====================================================
+// Algorithms accepting a traced policy
+// ====================================================
+
+template <typename Policy, typename ForwardIt, typename UnaryFunction>
+void for_each(const execution::traced_policy<Policy>& policy, ForwardIt first, ForwardIt last, UnaryFunction f) {
+    detail::traced_call(policy, detail::traced_elements(first, last),
+                        [&](const Policy& p) { std::for_each(p, first, last, f); });
+}
+
+template <typename Policy, typename ForwardIt1, typename ForwardIt2, typename UnaryOperation>
+ForwardIt2 transform(const execution::traced_policy<Policy>& policy, ForwardIt1 first1, ForwardIt1 last1,
+                     ForwardIt2 d_first, UnaryOperation unary_op) {
+    return detail::traced_call(policy, detail::traced_elements(first1, last1), [&](const Policy& p) {
+        return std::transform(p, first1, last1, d_first, unary_op);
+    });
+}
+
+template <typename Policy, typename ForwardIt1, typename ForwardIt2, typename ForwardIt3, typename BinaryOperation>
+ForwardIt3 transform(const execution::traced_policy<Policy>& policy, ForwardIt1 first1, ForwardIt1 last1,
+                     ForwardIt2 first2, ForwardIt3 d_first, BinaryOperation binary_op) {
+    return detail::traced_call(policy, detail::traced_elements(first1, last1), [&](const Policy& p) {
+        return std::transform(p, first1, last1, first2, d_first, binary_op);
+    });
+}
+
+template <typename Policy, typename ForwardIt, typename T, typename BinaryOp>
+T reduce(const execution::traced_policy<Policy>& policy, ForwardIt first, ForwardIt last, T init, BinaryOp binary_op) {
+    return detail::traced_call(policy, detail::traced_elements(first, last),
+                               [&](const Policy& p) { return std::reduce(p, first, last, init, binary_op); });
+}
+
+template <typename Policy, typename ForwardIt, typename T>
+T reduce(const execution::traced_policy<Policy>& policy, ForwardIt first, ForwardIt last, T init) {
+    return xstd::reduce(policy, first, last, init, std::plus<>());
+}
+
+template <typename Policy, typename ForwardIt1, typename ForwardIt2, typename T, typename BinaryReductionOp,
+          typename BinaryTransformOp>
+T transform_reduce(const execution::traced_policy<Policy>& policy, ForwardIt1 first1, ForwardIt1 last1,
+                   ForwardIt2 first2, T init, BinaryReductionOp reduce, BinaryTransformOp transform) {
+    return detail::traced_call(policy, detail::traced_elements(first1, last1), [&](const Policy& p) {
+        return std::transform_reduce(p, first1, last1, first2, init, reduce, transform);
+    });
+}
+
+template <typename Policy, typename ForwardIt, typename T, typename BinaryReductionOp, typename UnaryTransformOp>
+T transform_reduce(const execution::traced_policy<Policy>& policy, ForwardIt first, ForwardIt last, T init,
+                   BinaryReductionOp reduce, UnaryTransformOp transform) {
+    return detail::traced_call(policy, detail::traced_elements(first, last), [&](const Policy& p) {
+        return std::transform_reduce(p, first, last, init, reduce, transform);
+    });
+}
+
+template <typename Policy, typename ForwardIt1, typename ForwardIt2>
+ForwardIt2 copy(const execution::traced_policy<Policy>& policy, ForwardIt1 first, ForwardIt1 last,
+                ForwardIt2 d_first) {
+    return detail::traced_call(policy, detail::traced_elements(first, last),
+                               [&](const Policy& p) { return std::copy(p, first, last, d_first); });
+}
+
+template <typename Policy, typename ForwardIt, typename T>
+void fill(const execution::traced_policy<Policy>& policy, ForwardIt first, ForwardIt last, const T& value) {
+    detail::traced_call(policy, detail::traced_elements(first, last),
+                        [&](const Policy& p) { std::fill(p, first, last, value); });
+}
+
+template <typename Policy, typename ForwardIt1, typename ForwardIt2, typename BinaryOp>
+ForwardIt2 inclusive_scan(const execution::traced_policy<Policy>& policy, ForwardIt1 first, ForwardIt1 last,
+                          ForwardIt2 d_first, BinaryOp binary_op) {
+    return detail::traced_call(policy, detail::traced_elements(first, last), [&](const Policy& p) {
+        return std::inclusive_scan(p, first, last, d_first, binary_op);
+    });
+}
+
+template <typename Policy, typename RandomIt, typename Compare>
+void sort(const execution::traced_policy<Policy>& policy, RandomIt first, RandomIt last, Compare comp) {
+    detail::traced_call(policy, detail::traced_elements(first, last),
+                        [&](const Policy& p) { std::sort(p, first, last, comp); });
+}
+
+template <typename Policy, typename RandomIt>
+void sort(const execution::traced_policy<Policy>& policy, RandomIt first, RandomIt last) {
+    xstd::sort(policy, first, last, std::less<>());
+}
+
+} /* namespace xstd */
@@ -0,0 +1,127 @@
+/**
+ * \file       uninitialized.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>    // std::for_each
+#include <iterator>     // std::iterator_traits
+#include <memory>       // std::allocator, std::allocator_traits, std::addressof
+#include <new>          // placement new
+#include <type_traits>  // std::is_nothrow_*
+#include <utility>      // std::forward
+#include <vector>       // std::vector
+
+#include "xstd/range.hpp"
+
+namespace xstd {
+
+/** Allocator adaptor which default-initializes elements
+ *
+ * Elements constructed without arguments are default-initialized
+ * instead of value-initialized so containers of trivially
+ * constructible types (ex. double) are not zero filled.  This
+ * avoids a serial write pass and leaves the first touch of
+ * every page to the code which writes the real values.
+ * Construction with arguments is forwarded to the wrapped
+ * allocator.
+ *
+ * \tparam T Type of value to allocate
+ * \tparam Allocator Allocator to wrap (ex. xstd::aligned_allocator)
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class default_init_allocator : public Allocator {
+    using traits = std::allocator_traits<Allocator>;
+
+   public:
+    template <typename U>
+    struct rebind {
+        using other = default_init_allocator<U, typename traits::template rebind_alloc<U>>;
+    };
+
+    using Allocator::Allocator;
+
+    default_init_allocator() = default;
+
+    default_init_allocator(const Allocator& alloc) noexcept : Allocator(alloc) {}
+
+    template <typename U, typename A>
+    default_init_allocator(const default_init_allocator<U, A>& other) noexcept
+        : Allocator(static_cast<const A&>(other)) {}
+
+    template <typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) {
+        traits::construct(static_cast<Allocator&>(*this), ptr, std::forward<Args>(args)...);
+    }
+};
+
+/** std::vector which does not initialize trivial elements
+ *
+ * \code{.cpp}
+ * xstd::uninitialized_vector<double> x(N);                      // No zero fill
+ * xstd::uninitialized_fill(std::execution::par, x.begin(), x.end(), 1.0); // Parallel first touch
+ * \endcode
+ */
+template <typename T>
+using uninitialized_vector = std::vector<T, default_init_allocator<T>>;
+
+/** Construct copies of value in uninitialized memory using policy
+ *
+ * Each element is constructed by the thread the policy assigns it
+ * to so the pages of a freshly allocated array are first touched
+ * in parallel.  Types whose copy constructor may throw are
+ * constructed serially to keep the strong exception guarantee.
+ *
+ * \param policy[in] Execution policy
+ * \param first[in] Beginning of the uninitialized memory
+ * \param last[in] End of the uninitialized memory
+ * \param value[in] Value to construct with
+ */
+template <typename Policy, typename ForwardIt, typename T>
+void uninitialized_fill(Policy&& policy, ForwardIt first, ForwardIt last, const T& value) {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+    if constexpr (std::is_nothrow_constructible_v<value_type, const T&>) {
+        std::for_each(policy, first, last,
+                      [&value](auto& elem) { ::new (static_cast<void*>(std::addressof(elem))) value_type(value); });
+    } else {
+        std::uninitialized_fill(first, last, value);
+    }
+}
+
+/** Copy construct a range into uninitialized memory using policy
+ *
+ * Each destination element is constructed by the thread the policy
+ * assigns it to so the pages of a freshly allocated array are first
+ * touched in parallel.  Types whose constructor may throw are
+ * copied serially to keep the strong exception guarantee.
+ *
+ * \param policy[in] Execution policy
+ * \param first[in] Beginning of the source range
+ * \param last[in] End of the source range
+ * \param d_first[in] Beginning of the uninitialized memory
+ *
+ * \return Iterator to the element past the last element copied
+ */
+template <typename Policy, typename RandomIt1, typename RandomIt2>
+RandomIt2 uninitialized_copy(Policy&& policy, RandomIt1 first, RandomIt1 last, RandomIt2 d_first) {
+    using value_type = typename std::iterator_traits<RandomIt2>::value_type;
+    using reference  = typename std::iterator_traits<RandomIt1>::reference;
+    const auto n     = last - first;
+    if constexpr (std::is_nothrow_constructible_v<value_type, reference>) {
+        auto indices = xstd::range(n);
+        std::for_each(policy, indices.begin(), indices.end(), [first, d_first](auto i) {
+            ::new (static_cast<void*>(std::addressof(d_first[i]))) value_type(first[i]);
+        });
+        return d_first + n;
+    } else {
+        return std::uninitialized_copy(first, last, d_first);
+    }
+}
+
+} /* namespace xstd */
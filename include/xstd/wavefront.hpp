@@ -0,0 +1,158 @@
+/**
+ * \file       wavefront.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>  // std::for_each, std::min, std::max, std::upper_bound
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cstddef>    // std::size_t, std::ptrdiff_t
+#include <vector>     // std::vector
+
+#include "xstd/extent.hpp"
+#include "xstd/range.hpp"
+
+namespace xstd {
+namespace detail {
+
+/** First a of the (a,b) pairs on diagonal a+b=r with 0 <= b < nb
+ */
+inline std::ptrdiff_t diagonal_first(const std::ptrdiff_t r, const std::ptrdiff_t nb) {
+    return std::max<std::ptrdiff_t>(0, r - (nb - 1));
+}
+
+/** Number of (a,b) pairs on diagonal a+b=r with 0 <= a < na and 0 <= b < nb
+ */
+inline std::ptrdiff_t diagonal_count(const std::ptrdiff_t r, const std::ptrdiff_t na, const std::ptrdiff_t nb) {
+    return std::max<std::ptrdiff_t>(0, std::min(na - 1, r) - diagonal_first(r, nb) + 1);
+}
+
+/** Visit every point of a single tile in lexicographic order
+ */
+template <typename Function>
+void wavefront_tile(const nd_extent<2>& extent, const nd_extent<2>& tile, const nd_extent<2>& t, Function& f) {
+    const auto ilo = t[0] * tile[0];
+    const auto jlo = t[1] * tile[1];
+    const auto ihi = std::min(ilo + tile[0], extent[0]);
+    const auto jhi = std::min(jlo + tile[1], extent[1]);
+    for (auto i = ilo; i < ihi; ++i) {
+        for (auto j = jlo; j < jhi; ++j) {
+            f(i, j);
+        }
+    }
+}
+
+template <typename Function>
+void wavefront_tile(const nd_extent<3>& extent, const nd_extent<3>& tile, const nd_extent<3>& t, Function& f) {
+    const auto ilo = t[0] * tile[0];
+    const auto jlo = t[1] * tile[1];
+    const auto klo = t[2] * tile[2];
+    const auto ihi = std::min(ilo + tile[0], extent[0]);
+    const auto jhi = std::min(jlo + tile[1], extent[1]);
+    const auto khi = std::min(klo + tile[2], extent[2]);
+    for (auto i = ilo; i < ihi; ++i) {
+        for (auto j = jlo; j < jhi; ++j) {
+            for (auto k = klo; k < khi; ++k) {
+                f(i, j, k);
+            }
+        }
+    }
+}
+
+} /* namespace detail */
+
+/** Parallel for_each over a tiled index space in wavefront order
+ *
+ * Visits every index of the 2-D or 3-D index space one hyperplane
+ * of tiles (ti+tj[+tk] = constant) at a time.  Tiles within a
+ * hyperplane are executed in parallel using the provided policy
+ * while the points within a tile are visited in lexicographic order.
+ * Any point whose coordinates are all less than or equal to those
+ * of the current point is therefore completed before it is visited
+ * which satisfies the loop carried dependencies of Gauss-Seidel
+ * smoothers, line sweeps and upwind schemes.
+ *
+ * \param policy[in] Execution policy used within each hyperplane
+ * \param extent[in] Number of indices along each dimension
+ * \param tile[in] Size of a tile along each dimension
+ * \param f[in] Function called as f(i,j) or f(i,j,k)
+ *
+ * \code{.cpp}
+ * xstd::wavefront_for_each(std::execution::par, xstd::nd_extent<2>{ni, nj}, {64, 64},
+ *     [&](auto i, auto j) {
+ *         u[i][j] = 0.25 * (u[i-1][j] + u[i+1][j] + u[i][j-1] + u[i][j+1]);
+ *     });
+ * \endcode
+ */
+template <typename Policy, std::size_t N, typename Function>
+void wavefront_for_each(Policy&& policy, const nd_extent<N>& extent, const nd_extent<N>& tile, Function f) {
+    static_assert(N == 2 or N == 3, "Wavefront only supports 2-D and 3-D index spaces");
+
+    nd_extent<N> ntiles;
+    for (std::size_t d = 0; d < N; ++d) {
+        assert(tile[d] > 0);
+        if (extent[d] <= 0) {
+            return;
+        }
+        ntiles[d] = (extent[d] + tile[d] - 1) / tile[d];
+    }
+
+    std::ptrdiff_t nplanes = 1;
+    for (std::size_t d = 0; d < N; ++d) {
+        nplanes += ntiles[d] - 1;
+    }
+
+    if constexpr (N == 2) {
+        for (std::ptrdiff_t p = 0; p < nplanes; ++p) {
+            const auto first = detail::diagonal_first(p, ntiles[1]);
+            const auto count = detail::diagonal_count(p, ntiles[0], ntiles[1]);
+            auto plane       = xstd::range(count);
+            std::for_each(policy, plane.begin(), plane.end(), [&](auto n) {
+                const nd_extent<2> t{first + n, p - (first + n)};
+                detail::wavefront_tile(extent, tile, t, f);
+            });
+        }
+    } else {
+        std::vector<std::ptrdiff_t> offset(ntiles[0] + 1);
+        for (std::ptrdiff_t p = 0; p < nplanes; ++p) {
+            // Number of tiles on the plane before each ti
+            const auto ti_first = std::max<std::ptrdiff_t>(0, p - (ntiles[1] - 1) - (ntiles[2] - 1));
+            const auto ti_last  = std::min<std::ptrdiff_t>(ntiles[0] - 1, p);
+            const auto nti      = ti_last - ti_first + 1;
+            offset[0]           = 0;
+            for (std::ptrdiff_t n = 0; n < nti; ++n) {
+                offset[n + 1] = offset[n] + detail::diagonal_count(p - (ti_first + n), ntiles[1], ntiles[2]);
+            }
+
+            auto plane = xstd::range(offset[nti]);
+            std::for_each(policy, plane.begin(), plane.end(), [&](auto n) {
+                const auto m  = std::upper_bound(offset.begin(), offset.begin() + nti + 1, n) - offset.begin() - 1;
+                const auto ti = ti_first + m;
+                const auto r  = p - ti;
+                const auto tj = detail::diagonal_first(r, ntiles[2]) + (n - offset[m]);
+                const nd_extent<3> t{ti, tj, r - tj};
+                detail::wavefront_tile(extent, tile, t, f);
+            });
+        }
+    }
+}
+
+/** Parallel for_each over an index space in wavefront order
+ *
+ * Untiled version where each hyperplane (i+j[+k] = constant)
+ * of individual points is executed in parallel.
+ *
+ * \param policy[in] Execution policy used within each hyperplane
+ * \param extent[in] Number of indices along each dimension
+ * \param f[in] Function called as f(i,j) or f(i,j,k)
+ */
+template <typename Policy, std::size_t N, typename Function>
+void wavefront_for_each(Policy&& policy, const nd_extent<N>& extent, Function f) {
+    nd_extent<N> unit;
+    unit.fill(1);
+    wavefront_for_each(policy, extent, unit, f);
+}
+
+} /* namespace xstd */
@@ -529,7 +529,9 @@ struct zip_iterator {
     // Constructors
     // ====================================================
 
-    zip_iterator(Iterators&&... iterators) : iterators_(std::make_tuple(iterators...)) {}
+    zip_iterator() = default;
+
+    explicit zip_iterator(Iterators... iterators) : iterators_(iterators...) {}
 
     // ====================================================
     // Operators
@@ -567,12 +569,12 @@ struct zip_iterator {
         return *this;
     }
 
-    value_tuple operator[](const difference_type n) {
-        return xstd::transform(iterators_, [n](auto iter) -> decltype(*iter)& { return iter[n]; });
+    reference_tuple operator[](const difference_type n) const {
+        return xstd::transform(iterators_, [n](auto iter) -> decltype(*iter) { return iter[n]; });
     }
 
-    reference_tuple operator*() {
-        return xstd::transform(iterators_, [](auto iter) -> decltype(*iter)& { return *iter; });
+    reference_tuple operator*() const {
+        return xstd::transform(iterators_, [](auto iter) -> decltype(*iter) { return *iter; });
     }
 
     // ====================================================
@@ -587,19 +589,37 @@ struct zip_iterator {
 
     friend bool operator!=(const zip_iterator& x, const zip_iterator& y) { return not(x == y); }
 
-    friend bool operator<(const zip_iterator& x, const zip_iterator& y) {
-        return xstd::all_of(x.iterators_, y.iterators_, [](const auto& a, const auto& b) { return (a < b); });
-    }
+    friend bool operator<(const zip_iterator& x, const zip_iterator& y) { return (x - y) < 0; }
+
+    friend bool operator>(const zip_iterator& x, const zip_iterator& y) { return y < x; }
+
+    friend bool operator<=(const zip_iterator& x, const zip_iterator& y) { return not(y < x); }
+
+    friend bool operator>=(const zip_iterator& x, const zip_iterator& y) { return not(x < y); }
 
+    /** Distance between iterators
+     *
+     * The distance of smallest magnitude so zipped ranges of
+     * different length end with the shortest and x - y == -(y - x).
+     */
     friend difference_type operator-(const zip_iterator& x, const zip_iterator& y) {
-        auto diff_tuple =
-            xstd::transform(x.iterators_, y.iterators_, [](const auto& a, const auto& b) { return a - b; });
-        return xstd::min(diff_tuple);  // Return minimum distance
+        auto diff_tuple = xstd::transform(x.iterators_, y.iterators_, [](const auto& a, const auto& b) {
+            return static_cast<difference_type>(a - b);
+        });
+        return std::apply(
+            [](auto first, auto... rest) {
+                difference_type diff = first;
+                ((diff = ((rest < 0 ? -rest : rest) < (diff < 0 ? -diff : diff)) ? rest : diff), ...);
+                return diff;
+            },
+            diff_tuple);
     }
 
-    friend zip_iterator operator+(zip_iterator x, difference_type y) { return x += y; }
+    friend zip_iterator operator+(zip_iterator x, const difference_type y) { return x += y; }
+
+    friend zip_iterator operator+(const difference_type x, zip_iterator y) { return y += x; }
 
-    friend zip_iterator operator+(difference_type x, zip_iterator y) { return y += x; }
+    friend zip_iterator operator-(zip_iterator x, const difference_type y) { return x -= y; }
 
    private:
     iterator_tuple iterators_;
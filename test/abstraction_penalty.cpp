@@ -0,0 +1,310 @@
+/**
+ * \file       abstraction_penalty.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "helpers.hpp"
+#include "xstd/range.hpp"
+#include "xstd/stop_watch.hpp"
+#include "xstd/strided.hpp"
+#include "xstd/zip.hpp"
+
+/** Largest slowdown of an adaptor not flagged
+ */
+constexpr double ALLOWED_SLOWDOWN = 1.05;
+
+/** Median time of ncycle calls of body
+ */
+template <typename Body>
+double median_seconds(const std::size_t ncycle, Body&& body) {
+    xstd::StopWatch watch;
+    std::vector<double> times;
+    for (std::size_t i = 0; i < ncycle; ++i) {
+        watch.restart();
+        body();
+        watch.stop();
+        times.push_back(watch.elapsed_seconds());
+    }
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    return times[times.size() / 2];
+}
+
+/** Run kernel(first, last) over [0,n) split evenly across std::threads
+ */
+template <typename Kernel>
+void raw_threads(const std::size_t n, Kernel&& kernel) {
+    const std::size_t nthreads = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::thread> team;
+    for (std::size_t t = 0; t < nthreads; ++t) {
+        team.emplace_back([&, t]() { kernel(n * t / nthreads, n * (t + 1) / nthreads); });
+    }
+    for (auto& thread : team) {
+        thread.join();
+    }
+}
+
+/** Run kernel(first, last) over [0,n) split evenly across OpenMP threads
+ */
+template <typename Kernel>
+void raw_openmp(const std::size_t n, Kernel&& kernel) {
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+        const std::size_t t        = omp_get_thread_num();
+        const std::size_t nthreads = omp_get_num_threads();
+        kernel(n * t / nthreads, n * (t + 1) / nthreads);
+    }
+#else
+    kernel(std::size_t(0), n);
+#endif
+}
+
+/** Problem data and the times of the raw loops to compare against
+ *
+ * Every variant starts from the same y and z and updates them
+ * ncycle times so the results can be compared with the serial
+ * raw loop.
+ */
+class Problem {
+   public:
+    using T = double;
+
+    Problem(const std::string& name, const std::size_t n, const std::size_t stride, const std::size_t ncycle)
+        : name_(name), n_(n), stride_(stride), ncycle_(ncycle), x_(n * stride), y_(n * stride), z_(n * stride),
+          y0_(n * stride), z0_(n * stride) {
+        cached_random_fill(x_, 1);
+        cached_random_fill(y0_, 2);
+        cached_random_fill(z0_, 3);
+    }
+
+    std::size_t size() const { return n_; }
+    std::size_t stride() const { return stride_; }
+    T* x() { return x_.data(); }
+    T* y() { return y_.data(); }
+    T* z() { return z_.data(); }
+    std::vector<T>& xv() { return x_; }
+    std::vector<T>& yv() { return y_; }
+    std::vector<T>& zv() { return z_; }
+
+    /** Time the raw loops given kernel(first, last) over element indices
+     */
+    template <typename Kernel>
+    bool baseline(Kernel&& kernel) {
+        serial_ = this->time("raw serial", [&]() { kernel(std::size_t(0), n_); });
+        answer_y_ = y_;
+        answer_z_ = z_;
+
+        bool correct = true;
+#ifdef _OPENMP
+        const double openmp = this->time("raw OpenMP", [&]() { raw_openmp(n_, kernel); });
+        correct             = correct and this->matches();
+#else
+        const double openmp = 0;
+        std::cout << name_ << ": raw OpenMP not available\n";
+#endif
+        const double threads = this->time("raw std::thread", [&]() { raw_threads(n_, kernel); });
+        correct              = correct and this->matches();
+
+        parallel_      = (openmp > 0) ? std::min(openmp, threads) : threads;
+        parallel_name_ = (openmp > 0 and openmp < threads) ? "raw OpenMP" : "raw std::thread";
+        return correct;
+    }
+
+    /** Time an adaptor version and compare with the raw baseline
+     *
+     * Returns if the result matches the raw loop.  Slowdowns above
+     * the allowed ratio are flagged but are not failures.
+     */
+    template <typename Body>
+    bool compare(const std::string& variant, const bool parallel, Body&& body) {
+        const double seconds  = this->time(variant, body, false);
+        const double baseline = parallel ? parallel_ : serial_;
+        const double ratio    = seconds / baseline;
+        const bool correct    = this->matches();
+        std::cout << name_ << ": " << variant << "  Time (sec) = " << std::scientific << seconds << "  vs "
+                  << (parallel ? parallel_name_ : "raw serial") << "  Ratio = " << std::defaultfloat << ratio
+                  << "  Correct = " << std::boolalpha << correct;
+        if (ratio > ALLOWED_SLOWDOWN) {
+            std::cout << "  <-- over " << std::defaultfloat << 100 * (ALLOWED_SLOWDOWN - 1) << "% slower";
+        }
+        std::cout << std::endl;
+        return correct;
+    }
+
+   private:
+    std::string name_;
+    std::size_t n_;
+    std::size_t stride_;
+    std::size_t ncycle_;
+    std::vector<T> x_, y_, z_, y0_, z0_;
+    std::vector<T> answer_y_, answer_z_;
+    double serial_   = 0;
+    double parallel_ = 0;
+    std::string parallel_name_;
+
+    template <typename Body>
+    double time(const std::string& variant, Body&& body, const bool print = true) {
+        y_              = y0_;
+        z_              = z0_;
+        const double tm = median_seconds(ncycle_, body);
+        if (print) {
+            std::cout << name_ << ": " << variant << "  Time (sec) = " << std::scientific << tm << std::endl;
+        }
+        return tm;
+    }
+
+    // Loops may contract a * x + y into an FMA differently
+    bool matches() const {
+        auto close = [](T u, T v) { return std::abs(u - v) <= 1.0e-12 * std::abs(v); };
+        return std::equal(y_.begin(), y_.end(), answer_y_.begin(), close) and
+               std::equal(z_.begin(), z_.end(), answer_z_.begin(), close);
+    }
+};
+
+/** Time every adaptor version of an operation under each policy
+ */
+template <typename Policy>
+bool run_saxpy(Problem& p, const Policy policy, const std::string& policy_name, const bool parallel) {
+    using T     = Problem::T;
+    const T a   = 1.0e-3;
+    T* x        = p.x();
+    T* y        = p.y();
+    auto r      = xstd::range(p.size());
+    auto zip_xy = xstd::zip(p.xv(), p.yv());
+
+    std::vector<bool> correct;
+    correct.push_back(p.compare("std::transform " + policy_name, parallel, [&]() {
+        std::transform(policy, p.xv().begin(), p.xv().end(), p.yv().begin(), p.yv().begin(),
+                       [a](T xval, T yval) { return yval + a * xval; });
+    }));
+    correct.push_back(p.compare("xstd::range " + policy_name, parallel, [&]() {
+        std::for_each(policy, r.begin(), r.end(), [=](std::size_t i) { y[i] += a * x[i]; });
+    }));
+    correct.push_back(p.compare("xstd::zip " + policy_name, parallel, [&]() {
+        std::for_each(policy, zip_xy.begin(), zip_xy.end(), [a](auto v) { std::get<1>(v) += a * std::get<0>(v); });
+    }));
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+template <typename Policy>
+bool run_strided(Problem& p, const Policy policy, const std::string& policy_name, const bool parallel) {
+    using T      = Problem::T;
+    const T a    = 1.0e-3;
+    const auto s = p.stride();
+    T* x         = p.x();
+    T* y         = p.y();
+    auto r       = xstd::range(p.size());
+    auto sx      = xstd::strided(p.xv(), s);
+    auto sy      = xstd::strided(p.yv(), s);
+
+    std::vector<bool> correct;
+    correct.push_back(p.compare("xstd::range " + policy_name, parallel, [&]() {
+        std::for_each(policy, r.begin(), r.end(), [=](std::size_t i) { y[i * s] += a * x[i * s]; });
+    }));
+    correct.push_back(p.compare("xstd::strided " + policy_name, parallel, [&]() {
+        std::transform(policy, sx.begin(), sx.end(), sy.begin(), sy.begin(),
+                       [a](T xval, T yval) { return yval + a * xval; });
+    }));
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+template <typename Policy>
+bool run_update(Problem& p, const Policy policy, const std::string& policy_name, const bool parallel) {
+    using T       = Problem::T;
+    const T a     = 1.0e-3;
+    const T b     = 2.0e-3;
+    T* x          = p.x();
+    T* y          = p.y();
+    T* z          = p.z();
+    auto r        = xstd::range(p.size());
+    auto zip_xyz  = xstd::zip(p.xv(), p.yv(), p.zv());
+
+    std::vector<bool> correct;
+    correct.push_back(p.compare("xstd::range " + policy_name, parallel, [&]() {
+        std::for_each(policy, r.begin(), r.end(), [=](std::size_t i) {
+            y[i] += a * x[i];
+            z[i] += b * y[i];
+        });
+    }));
+    correct.push_back(p.compare("xstd::zip " + policy_name, parallel, [&]() {
+        std::for_each(policy, zip_xyz.begin(), zip_xyz.end(), [a, b](auto v) {
+            std::get<1>(v) += a * std::get<0>(v);
+            std::get<2>(v) += b * std::get<1>(v);
+        });
+    }));
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+/** Run an operation under every policy
+ */
+template <typename Run>
+bool run_policies(Problem& p, Run&& run) {
+    std::vector<bool> correct;
+    correct.push_back(run(p, std::execution::seq, "seq", false));
+    correct.push_back(run(p, std::execution::unseq, "unseq", false));
+    correct.push_back(run(p, std::execution::par, "par", true));
+    correct.push_back(run(p, std::execution::par_unseq, "par_unseq", true));
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using T                     = Problem::T;
+    constexpr std::size_t NWORK = 400000000;  // Elements processed per variant
+    constexpr std::size_t STRIDE = 4;         // Stride of strided SAXPY
+
+    std::vector<bool> correct;
+
+    // Sizes in cache (overhead shows) and in main memory (bandwidth hides it)
+    for (const std::size_t n : {std::size_t(1) << 14, std::size_t(1) << 23}) {
+        const std::size_t ncycle = std::max<std::size_t>(NWORK / n, 11);
+        const std::string size   = " N=" + std::to_string(n);
+        const T a                = 1.0e-3;
+        const T b                = 2.0e-3;
+
+        Problem saxpy("saxpy" + size, n, 1, ncycle);
+        correct.push_back(saxpy.baseline([x = saxpy.x(), y = saxpy.y(), a](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                y[i] += a * x[i];
+            }
+        }));
+        correct.push_back(run_policies(saxpy, [](auto&&... args) { return run_saxpy(args...); }));
+
+        Problem strided("strided saxpy" + size, n / STRIDE, STRIDE, ncycle);
+        correct.push_back(
+            strided.baseline([x = strided.x(), y = strided.y(), a](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) {
+                    y[i * STRIDE] += a * x[i * STRIDE];
+                }
+            }));
+        correct.push_back(run_policies(strided, [](auto&&... args) { return run_strided(args...); }));
+
+        Problem update("3-array update" + size, n, 1, ncycle);
+        correct.push_back(update.baseline(
+            [x = update.x(), y = update.y(), z = update.z(), a, b](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) {
+                    y[i] += a * x[i];
+                    z[i] += b * y[i];
+                }
+            }));
+        correct.push_back(run_policies(update, [](auto&&... args) { return run_update(args...); }));
+    }
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -0,0 +1,120 @@
+/**
+ * \file       aligned_vector.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <execution>
+#include <iostream>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/aligned_allocator.hpp"
+
+/** Functor to Time
+ *
+ * SAXPY on aligned vectors where y is shifted by a
+ * byte offset relative to x.  When the offset keeps y on a
+ * cache line the kernel passes alignment hints to the algorithm.
+ */
+template <typename T>
+class ALIGNED_SAXPY {
+   public:
+    using vector_type = xstd::aligned_vector<T>;
+
+    /** Construct the functor
+     */
+    ALIGNED_SAXPY(const T a, const vector_type& x, const vector_type& y)
+        : a_(a), x_(x), y_(y), temp_(y.get_allocator()), answer_(y.begin(), y.end()) {
+        for (std::size_t i = 0; i < x_.size(); ++i) {
+            answer_[i] += (a_ * x_[i]);
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { temp_ = y_; }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        constexpr auto alignment = vector_type::allocator_type::alignment;
+        if (temp_.get_allocator().guaranteed_alignment() == alignment) {
+            auto x = xstd::aligned<alignment>(x_);
+            auto y = xstd::aligned<alignment>(temp_);
+            std::transform(policy, x.begin(), x.end(), y.begin(), y.begin(),
+                           [a = this->a_](auto xi, auto yi) { return yi + (a * xi); });
+        } else {
+            std::transform(policy, x_.begin(), x_.end(), temp_.begin(), temp_.begin(),
+                           [a = this->a_](auto xi, auto yi) { return yi + (a * xi); });
+        }
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
+
+    /** Floating point operations of one run (multiply and add)
+     */
+    double flops() const { return 2.0 * x_.size(); }
+
+    /** Bytes moved by one run (read x and y, write y)
+     */
+    double bytes() const { return 3.0 * sizeof(T) * x_.size(); }
+
+   private:
+    T a_;
+    vector_type x_;
+    vector_type y_;
+    vector_type temp_;
+    std::vector<T> answer_;
+};
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;       // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 8388608;  // Length of Vectors (power of 2)
+
+    // Data for problem
+    const Real a(5);
+    std::vector<Real> x(NSIZE);
+    std::vector<Real> y(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
+
+    // Offset of y from x in bytes
+    for (std::size_t offset : {0, 8, 64, 128, 512, 2048}) {
+        xstd::aligned_vector<Real> ax(x.begin(), x.end());
+        xstd::aligned_vector<Real> ay(y.begin(), y.end(), xstd::aligned_allocator<Real>(offset));
+
+        // Create Functor
+        ALIGNED_SAXPY<Real> op(a, ax, ay);
+
+        // Calculate Timings
+        std::cout << "Offset = " << offset << " bytes: std::execution::seq\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+
+        std::cout << "Offset = " << offset << " bytes: std::execution::unseq\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, op));
+
+        std::cout << "Offset = " << offset << " bytes: std::execution::par\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+
+        std::cout << "Offset = " << offset << " bytes: std::execution::par_unseq\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, op));
+    }
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -0,0 +1,150 @@
+/**
+ * \file       arena.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <execution>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "xstd/arena.hpp"
+
+#if XSTD_ARENA_TBB && __has_include(<tbb/global_control.h>)
+#include <tbb/global_control.h>
+#define HAVE_TBB_CONTROL 1
+#else
+#define HAVE_TBB_CONTROL 0
+#endif
+
+#include "helpers.hpp"
+#include "xstd/range.hpp"
+#include "xstd/stop_watch.hpp"
+
+/** Most threads running a parallel loop at once inside an arena
+ *
+ * Each iteration spins briefly so threads joining the loop
+ * overlap and are counted.
+ */
+std::size_t most_active_threads(xstd::arena& arena) {
+    std::atomic<std::size_t> active{0};
+    std::atomic<std::size_t> most{0};
+    auto r = xstd::range(std::size_t(256));
+    arena.execute([&]() {
+        std::for_each(std::execution::par, r.begin(), r.end(), [&](std::size_t) {
+            const auto now = ++active;
+            auto seen      = most.load();
+            while (now > seen and not most.compare_exchange_weak(seen, now)) {
+            }
+            const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+            while (std::chrono::steady_clock::now() < until) {
+            }
+            --active;
+        });
+    });
+    return most.load();
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;               // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 1 << 23;          // Length of Vectors
+    constexpr std::size_t NSAXPY = 20;               // SAXPY sweeps per workload
+    const std::size_t NTHREAD    = std::max(2U, std::thread::hardware_concurrency());
+
+    std::vector<bool> correct;
+
+    // Allow the arenas their threads even beyond the core count
+#if HAVE_TBB_CONTROL
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, NTHREAD);
+#endif
+
+    xstd::arena full(NTHREAD);
+    xstd::arena left(NTHREAD / 2);
+    xstd::arena right(NTHREAD - NTHREAD / 2);
+
+    // Parallel calls stay within the threads of their arena
+    for (auto* arena : {&full, &left}) {
+        const auto most = most_active_threads(*arena);
+        const bool ok   = (most >= 1) and (most <= arena->concurrency());
+        correct.push_back(ok);
+        std::cout << "Arena of " << arena->concurrency() << " threads: Most Active = " << most
+                  << "  Correct = " << std::boolalpha << ok << std::endl;
+    }
+
+    // Data for the two workloads
+    const Real a(5);
+    std::vector<Real> x(NSIZE);
+    std::vector<Real> y0(NSIZE);
+    std::vector<Real> y(NSIZE);
+    std::vector<Real> unsorted(NSIZE);
+    std::vector<Real> sorted(NSIZE);
+    cached_random_fill(x, 1);
+    cached_random_fill(y0, 2);
+    cached_random_fill(unsorted, 3);
+
+    std::vector<Real> answer_y(y0);
+    for (std::size_t k = 0; k < NSAXPY; ++k) {
+        std::transform(x.begin(), x.end(), answer_y.begin(), answer_y.begin(),
+                       [a](Real xval, Real yval) { return yval + a * xval; });
+    }
+    std::vector<Real> answer_sorted(unsorted);
+    std::sort(answer_sorted.begin(), answer_sorted.end());
+
+    auto saxpy = [&]() {
+        for (std::size_t k = 0; k < NSAXPY; ++k) {
+            std::transform(std::execution::par, x.begin(), x.end(), y.begin(), y.begin(),
+                           [a](Real xval, Real yval) { return yval + a * xval; });
+        }
+    };
+    auto sort = [&]() { std::sort(std::execution::par, sorted.begin(), sorted.end()); };
+
+    auto reset = [&]() {
+        y      = y0;
+        sorted = unsorted;
+    };
+    auto check = [&]() { return (y == answer_y) and (sorted == answer_sorted); };
+
+    // Back to back on all threads against side by side on half each
+    xstd::StopWatch watch;
+    double sequential = 0;
+    double concurrent = 0;
+    for (std::size_t cycle = 0; cycle < NCYLCE; ++cycle) {
+        reset();
+        watch.restart();
+        full.execute(saxpy);
+        full.execute(sort);
+        watch.stop();
+        sequential += watch.elapsed_seconds();
+        correct.push_back(check());
+
+        reset();
+        watch.restart();
+        auto saxpy_done = left.async(saxpy);
+        auto sort_done  = right.async(sort);
+        saxpy_done.get();
+        sort_done.get();
+        watch.stop();
+        concurrent += watch.elapsed_seconds();
+        correct.push_back(check());
+    }
+    sequential /= NCYLCE;
+    concurrent /= NCYLCE;
+
+    const bool ok = std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+    std::cout << "SAXPY + sort back to back on " << full.concurrency() << " threads: Time (sec) = "
+              << std::scientific << sequential << std::endl;
+    std::cout << "SAXPY + sort side by side on " << left.concurrency() << " + " << right.concurrency()
+              << " threads: Time (sec) = " << concurrent << std::endl;
+    std::cout << "Speedup = " << std::defaultfloat << sequential / concurrent << "  Correct = " << std::boolalpha
+              << ok << std::endl;
+
+    return not ok;
+}
@@ -0,0 +1,390 @@
+/**
+ * \file       colored_range.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <execution>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/colored_range.hpp"
+
+/** Single SOR point update of the 2-D Poisson equation
+ */
+template <typename T>
+struct SOR_UPDATE {
+    std::ptrdiff_t n;
+    T omega;
+    const T* rhs;
+
+    void operator()(T* u, const std::ptrdiff_t i, const std::ptrdiff_t j) const {
+        const auto ij = i * n + j;
+        const T gs    = T(0.25) * (u[ij - n] + u[ij + n] + u[ij - 1] + u[ij + 1] - rhs[ij]);
+        u[ij]         = (T(1) - omega) * u[ij] + omega * gs;
+    }
+};
+
+/** Functor to Time a red-black SOR sweep
+ */
+template <typename T>
+class RED_BLACK_SOR {
+   public:
+    /** Construct the functor
+     *
+     * The answer is a serial sweep over each color with
+     * plain nested loops.
+     */
+    RED_BLACK_SOR(const std::ptrdiff_t n, const T omega, const std::vector<T>& u, const std::vector<T>& rhs)
+        : n_(n), u_(u), rhs_(rhs), answer_(u), update_{n, omega, nullptr} {
+        update_.rhs = rhs_.data();
+        for (int color = 0; color < 2; ++color) {
+            for (std::ptrdiff_t i = 1; i < n_ - 1; ++i) {
+                for (std::ptrdiff_t j = 1; j < n_ - 1; ++j) {
+                    if ((i - 1 + j - 1) % 2 == color) {
+                        update_(answer_.data(), i, j);
+                    }
+                }
+            }
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { temp_ = u_; }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        for (int color = 0; color < 2; ++color) {
+            auto points = xstd::colored_range<2>({n_ - 2, n_ - 2}, xstd::coloring::red_black, color);
+            std::for_each(policy, points.begin(), points.end(),
+                          [update = this->update_, u = this->temp_.data()](auto idx) {
+                              update(u, idx[0] + 1, idx[1] + 1);
+                          });
+        }
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
+
+    /** Floating point operations of one run (9 per interior point)
+     */
+    double flops() const { return 9.0 * double((n_ - 2) * (n_ - 2)); }
+
+    /** Bytes of one run moving u (read and write) and rhs once
+     *
+     * The compulsory traffic, a lower bound when the sweep over each color
+     * reloads lines evicted between uses.
+     */
+    double bytes() const { return 3.0 * sizeof(T) * double(u_.size()); }
+
+   private:
+    std::ptrdiff_t n_;
+    std::vector<T> u_;
+    std::vector<T> rhs_;
+    std::vector<T> temp_;
+    std::vector<T> answer_;
+    SOR_UPDATE<T> update_;
+};
+
+/** Functor to Time a serial lexicographic SOR sweep
+ */
+template <typename T>
+class LEXICOGRAPHIC_SOR {
+   public:
+    /** Construct the functor
+     */
+    LEXICOGRAPHIC_SOR(const std::ptrdiff_t n, const T omega, const std::vector<T>& u, const std::vector<T>& rhs)
+        : n_(n), u_(u), rhs_(rhs), answer_(u), update_{n, omega, nullptr} {
+        update_.rhs = rhs_.data();
+        this->sweep(answer_.data());
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { temp_ = u_; }
+
+    /** Perform timed calculation
+     *
+     * Loop carried dependencies prevent using the policy.
+     */
+    template <typename Policy>
+    void operator()(const Policy) {
+        this->sweep(temp_.data());
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
+
+    /** Floating point operations of one run (9 per interior point)
+     */
+    double flops() const { return 9.0 * double((n_ - 2) * (n_ - 2)); }
+
+    /** Bytes of one run moving u (read and write) and rhs once
+     *
+     * The compulsory traffic, a lower bound when the sweep
+     * reloads lines evicted between uses.
+     */
+    double bytes() const { return 3.0 * sizeof(T) * double(u_.size()); }
+
+   private:
+    std::ptrdiff_t n_;
+    std::vector<T> u_;
+    std::vector<T> rhs_;
+    std::vector<T> temp_;
+    std::vector<T> answer_;
+    SOR_UPDATE<T> update_;
+
+    void sweep(T* u) const {
+        for (std::ptrdiff_t i = 1; i < n_ - 1; ++i) {
+            for (std::ptrdiff_t j = 1; j < n_ - 1; ++j) {
+                update_(u, i, j);
+            }
+        }
+    }
+};
+
+/** Color of a point by brute force from its coordinates
+ */
+template <std::size_t N>
+int color_of(const xstd::nd_index<N>& index, const xstd::coloring order) {
+    int color = 0;
+    for (std::size_t d = 0; d < N; ++d) {
+        if (order == xstd::coloring::red_black) {
+            color = (color + int(index[d] % 2)) % 2;
+        } else {
+            color = 2 * color + int(index[d] % 2);
+        }
+    }
+    return color;
+}
+
+/** Check every color of a grid enumerates the points of a parity filter
+ *
+ * Walks the grid lexicographically keeping the points whose
+ * color matches and compares them, in order, with the points
+ * of colored_range (through both the iterator and operator[]).
+ */
+template <std::size_t N>
+bool check_enumeration(const xstd::nd_extent<N>& extent, const xstd::coloring order) {
+    bool correct = true;
+    for (int color = 0; color < xstd::ncolors<N>(order); ++color) {
+        std::vector<xstd::nd_index<N>> expected;
+        xstd::nd_index<N> index{};
+        bool empty = false;
+        for (std::size_t d = 0; d < N; ++d) {
+            empty = empty or (extent[d] == 0);
+        }
+        while (not empty) {
+            if (color_of<N>(index, order) == color) {
+                expected.push_back(index);
+            }
+            std::size_t d = N;
+            while (d-- > 0 and ++index[d] == extent[d]) {
+                index[d] = 0;
+            }
+            if (d == std::size_t(-1)) {
+                break;
+            }
+        }
+
+        auto points = xstd::colored_range<N>(extent, order, color);
+        bool ok     = (points.size() == std::ptrdiff_t(expected.size())) and
+                  std::equal(points.begin(), points.end(), expected.begin(), expected.end());
+        for (std::ptrdiff_t n = 0; ok and n < points.size(); ++n) {
+            ok = (points.begin()[n] == expected[n]);
+        }
+        correct = correct and ok;
+    }
+    return correct;
+}
+
+/** Single 27-point SOR point update of a 3-D grid
+ */
+template <typename T>
+struct SOR_UPDATE_27 {
+    std::ptrdiff_t n;
+    T omega;
+    const T* rhs;
+
+    void operator()(T* u, const std::ptrdiff_t i, const std::ptrdiff_t j, const std::ptrdiff_t k) const {
+        const auto ijk = (i * n + j) * n + k;
+        T sum          = 0;
+        for (std::ptrdiff_t di = -1; di <= 1; ++di) {
+            for (std::ptrdiff_t dj = -1; dj <= 1; ++dj) {
+                for (std::ptrdiff_t dk = -1; dk <= 1; ++dk) {
+                    sum += u[ijk + (di * n + dj) * n + dk];
+                }
+            }
+        }
+        const T gs = (sum - u[ijk] - rhs[ijk]) / T(26);
+        u[ijk]     = (T(1) - omega) * u[ijk] + omega * gs;
+    }
+};
+
+/** Functor to Time an 8-color 3-D SOR sweep
+ *
+ * Points of one multi-color share the parity of every
+ * coordinate so none are 27-point neighbors.
+ */
+template <typename T>
+class MULTI_COLOR_SOR {
+   public:
+    /** Construct the functor
+     *
+     * The answer is a serial sweep over each color with
+     * plain nested loops.
+     */
+    MULTI_COLOR_SOR(const std::ptrdiff_t n, const T omega, const std::vector<T>& u, const std::vector<T>& rhs)
+        : n_(n), u_(u), rhs_(rhs), answer_(u), update_{n, omega, nullptr} {
+        update_.rhs = rhs_.data();
+        for (int color = 0; color < 8; ++color) {
+            for (std::ptrdiff_t i = 1; i < n_ - 1; ++i) {
+                for (std::ptrdiff_t j = 1; j < n_ - 1; ++j) {
+                    for (std::ptrdiff_t k = 1; k < n_ - 1; ++k) {
+                        if (4 * ((i - 1) % 2) + 2 * ((j - 1) % 2) + (k - 1) % 2 == color) {
+                            update_(answer_.data(), i, j, k);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { temp_ = u_; }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        for (int color = 0; color < 8; ++color) {
+            auto points = xstd::colored_range<3>({n_ - 2, n_ - 2, n_ - 2}, xstd::coloring::multi_color, color);
+            std::for_each(policy, points.begin(), points.end(),
+                          [update = this->update_, u = this->temp_.data()](auto idx) {
+                              update(u, idx[0] + 1, idx[1] + 1, idx[2] + 1);
+                          });
+        }
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
+
+    /** Floating point operations of one run (33 per interior point)
+     */
+    double flops() const { return 33.0 * double((n_ - 2) * (n_ - 2) * (n_ - 2)); }
+
+    /** Bytes of one run moving u (read and write) and rhs once
+     *
+     * The compulsory traffic, a lower bound when the sweep over each color
+     * reloads lines evicted between uses.
+     */
+    double bytes() const { return 3.0 * sizeof(T) * double(u_.size()); }
+
+   private:
+    std::ptrdiff_t n_;
+    std::vector<T> u_;
+    std::vector<T> rhs_;
+    std::vector<T> temp_;
+    std::vector<T> answer_;
+    SOR_UPDATE_27<T> update_;
+};
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE   = 10;    // Number of time to repeat test
+    constexpr std::ptrdiff_t NDIM  = 2048;  // Grid points in each direction
+    constexpr std::ptrdiff_t NDIM3 = 160;   // Grid points in each direction (3-D)
+
+    std::vector<bool> correct;
+
+    // Enumeration of every coloring against a brute force filter
+    for (const auto order : {xstd::coloring::red_black, xstd::coloring::multi_color}) {
+        const std::string name = (order == xstd::coloring::red_black) ? "red-black" : "multi-color";
+        bool ok                = true;
+        for (const xstd::nd_extent<2> extent : {xstd::nd_extent<2>{5, 7}, xstd::nd_extent<2>{6, 4},
+                                                xstd::nd_extent<2>{1, 3}, xstd::nd_extent<2>{0, 3}}) {
+            ok = ok and check_enumeration<2>(extent, order);
+        }
+        for (const xstd::nd_extent<3> extent : {xstd::nd_extent<3>{3, 4, 5}, xstd::nd_extent<3>{4, 4, 4},
+                                                xstd::nd_extent<3>{1, 2, 3}, xstd::nd_extent<3>{5, 0, 2}}) {
+            ok = ok and check_enumeration<3>(extent, order);
+        }
+        std::cout << "Enumeration " << name << " (2-D and 3-D): Correct = " << std::boolalpha << ok << std::endl;
+        correct.push_back(ok);
+    }
+
+    // Data for problem
+    const Real omega(1.5);
+    std::vector<Real> u(NDIM * NDIM);
+    std::vector<Real> rhs(NDIM * NDIM);
+
+    // Initialize Data
+    cached_random_fill(u, 1);
+    cached_random_fill(rhs, 2);
+
+    // Create Functors
+    LEXICOGRAPHIC_SOR<Real> lex(NDIM, omega, u, rhs);
+    RED_BLACK_SOR<Real> colored(NDIM, omega, u, rhs);
+
+    // Calculate Timings
+    std::cout << "Lexicographic: serial\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, lex));
+
+    std::cout << "Red-Black: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, colored));
+
+    std::cout << "Red-Black: std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, colored));
+
+    std::cout << "Red-Black: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, colored));
+
+    std::cout << "Red-Black: std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, colored));
+
+    // 8-color 3-D sweep
+    std::vector<Real> u3(NDIM3 * NDIM3 * NDIM3);
+    std::vector<Real> rhs3(NDIM3 * NDIM3 * NDIM3);
+    cached_random_fill(u3, 3);
+    cached_random_fill(rhs3, 4);
+    MULTI_COLOR_SOR<Real> colored3(NDIM3, omega, u3, rhs3);
+
+    std::cout << "8-Color 3-D: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, colored3));
+
+    std::cout << "8-Color 3-D: std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, colored3));
+
+    std::cout << "8-Color 3-D: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, colored3));
+
+    std::cout << "8-Color 3-D: std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, colored3));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -0,0 +1,176 @@
+/**
+ * \file       compressed_array.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/compressed_array.hpp"
+#include "xstd/stop_watch.hpp"
+
+/** Functor to Time
+ *
+ * Read-mostly kernels on a field stored either as a std::vector
+ * or as a compressed_array read through its decoding iterators.
+ * The SAXPY reads the field x and updates y while the reduction
+ * only reads x.  Also times itself to report the effective
+ * bandwidth (uncompressed bytes of x and y moved per second).
+ */
+template <typename Field>
+class FIELD_KERNEL {
+   public:
+    using T = double;
+
+    /** Construct the functor
+     *
+     * The answers use the values of the field after compression
+     * so only the kernel is checked and not the compression error.
+     */
+    FIELD_KERNEL(const T a, Field x, const std::vector<T>& y, const bool reduce)
+        : a_(a), x_(std::move(x)), y_(y), temp_(y.size()), answer_(y), reduce_(reduce) {
+        std::vector<T> xval(x_.size());
+        std::copy(x_.begin(), x_.end(), xval.begin());
+        for (std::size_t i = 0; i < answer_.size(); ++i) {
+            answer_[i] += a_ * xval[i];
+        }
+        sum_answer_ = std::accumulate(xval.begin(), xval.end(), T(0), [](T s, T v) { return s + v * v; });
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() {
+        std::copy(y_.begin(), y_.end(), temp_.begin());
+        sum_ = 0;
+    }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        watch_.start();
+        if (reduce_) {
+            sum_ = std::transform_reduce(policy, x_.begin(), x_.end(), T(0), std::plus<>(), [](T v) { return v * v; });
+        } else {
+            std::transform(policy, x_.begin(), x_.end(), temp_.begin(), temp_.begin(),
+                           [a = this->a_](T xval, T yval) { return yval + (a * xval); });
+        }
+        watch_.stop();
+        bytes_ += x_.size() * sizeof(T) * (reduce_ ? 1 : 3);
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() {
+        if (reduce_) {
+            return std::abs(sum_ - sum_answer_) <= 1.0e-10 * std::abs(sum_answer_);
+        }
+        return std::equal(answer_.begin(), answer_.end(), temp_.begin());
+    }
+
+    /** Display bandwidth of all timed runs and clear it
+     */
+    void print_bandwidth() {
+        std::cout << "  Effective Bandwidth (GB/s) = " << std::defaultfloat
+                  << bytes_ / watch_.elapsed_seconds() / 1.0e9 << std::endl;
+        watch_.reset();
+        bytes_ = 0;
+    }
+
+   private:
+    T a_;
+    Field x_;
+    std::vector<T> y_;
+    std::vector<T> temp_;
+    std::vector<T> answer_;
+    T sum_answer_;
+    T sum_ = 0;
+    bool reduce_;
+    xstd::StopWatch watch_;
+    double bytes_ = 0;
+};
+
+/** Time functor under seq and par
+ */
+template <std::size_t NCYLCE, typename Field>
+bool run_all(const std::string& name, FIELD_KERNEL<Field>& op) {
+    std::vector<bool> correct;
+
+    std::cout << name << ": std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+    op.print_bandwidth();
+
+    std::cout << name << ": std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+    op.print_bandwidth();
+
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;        // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 20000000;  // Length of Vectors
+
+    // Data for problem
+    const Real a(5);
+    std::vector<Real> x(NSIZE);
+    std::vector<Real> y(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data (smooth field plus a little noise)
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
+    for (std::size_t i = 0; i < NSIZE; ++i) {
+        x[i] = std::sin(1.0e-5 * i) + 1.0e-6 * x[i];
+    }
+
+    struct mode {
+        std::string name;
+        xstd::compression compression;
+        unsigned bits;
+    };
+    const std::vector<mode> modes = {{"lossless", xstd::compression::lossless, 0},
+                                     {"truncate(20)", xstd::compression::truncate, 20},
+                                     {"fixed_rate(24)", xstd::compression::fixed_rate, 24}};
+
+    for (bool reduce : {false, true}) {
+        const std::string kernel = reduce ? "reduce" : "saxpy";
+        {
+            FIELD_KERNEL<std::vector<Real>> op(a, x, y, reduce);
+            correct.push_back(run_all<NCYLCE>(kernel + " std::vector", op));
+        }
+        for (const auto& m : modes) {
+            xstd::compressed_array<Real> cx(std::execution::par, x.begin(), x.end(), m.compression, m.bits);
+            std::vector<Real> decoded(NSIZE);
+            cx.decompress(std::execution::par, decoded.begin());
+            Real max_error = 0;
+            for (std::size_t i = 0; i < NSIZE; ++i) {
+                max_error = std::max(max_error, std::abs(decoded[i] - x[i]));
+            }
+            const auto name = kernel + " compressed " + m.name;
+            std::cout << name << ": Ratio = " << std::defaultfloat << cx.ratio() << " Max Error = " << max_error
+                      << std::endl;
+
+            FIELD_KERNEL<xstd::compressed_array<Real>> op(a, std::move(cx), y, reduce);
+            correct.push_back(run_all<NCYLCE>(name, op));
+        }
+    }
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -0,0 +1,201 @@
+/**
+ * \file       dataset_cache.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <execution>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "xstd/mmap_array.hpp"
+#include "xstd/range.hpp"
+
+/** Counter based random number generator
+ *
+ * The value at index i only depends on the seed and i so a
+ * dataset can be generated in parallel and is identical on
+ * every machine and for any number of threads.
+ */
+inline std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/** Uniform random value in [0,1) at index i of a sequence
+ *
+ * Values just below 1 may round up to 1 in float so are
+ * clamped to the largest value below 1.
+ */
+template <typename T>
+T uniform_value(const std::uint64_t seed, const std::uint64_t i) {
+    static_assert(std::is_floating_point_v<T>);
+    const auto bits  = splitmix64(splitmix64(seed) + i);
+    const auto value = static_cast<T>((bits >> 11) * (1.0 / 9007199254740992.0));  // 53 bits / 2^53
+    return std::min(value, std::nextafter(T(1), T(0)));
+}
+
+/** Header at the start of every cached dataset file
+ */
+struct dataset_header {
+    static constexpr char expected_magic[8] = {'P', 'S', 'T', 'L', 'D', 'A', 'T', 'A'};
+    static constexpr std::uint32_t expected_version = 2;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t value_size;
+    std::uint64_t seed;
+    std::uint64_t count;
+    std::uint64_t checksum;
+    char generator[24];
+};
+static_assert(sizeof(dataset_header) == 64);
+
+/** Checksum of values computed in parallel
+ *
+ * Sum of a hash of every value and its position so it does
+ * not depend on the order of the reduction but does detect
+ * values that are changed or moved.
+ */
+template <typename T>
+std::uint64_t dataset_checksum(const T* values, const std::size_t n) {
+    auto indices = xstd::range(n);
+    return std::transform_reduce(std::execution::par, indices.begin(), indices.end(), std::uint64_t(0),
+                                 std::plus<>(), [values](auto i) {
+                                     std::uint64_t bits = 0;
+                                     std::memcpy(&bits, values + i, sizeof(T));
+                                     return splitmix64(bits + 0x9E3779B97F4A7C15ULL * i);
+                                 });
+}
+
+/** Directory holding cached datasets
+ *
+ * The PSTL_DATASET_DIR environment variable if set, otherwise
+ * pstl_datasets within the temporary directory.
+ */
+inline std::filesystem::path dataset_directory() {
+    if (const char* dir = std::getenv("PSTL_DATASET_DIR")) {
+        return dir;
+    }
+    return std::filesystem::temp_directory_path() / "pstl_datasets";
+}
+
+/** Dataset of random values mapped from the cache
+ *
+ * Looks up the file keyed by generator, value type, seed and
+ * size in the cache directory and maps it.  If the file does not
+ * exist (or its header does not match) the values are generated
+ * in parallel and written to the cache first.  The file is
+ * written under a temporary name and renamed so benchmarks
+ * running at the same time never see partial files.
+ *
+ * The checksum over all values is checked after writing and
+ * the first time each file is loaded by a process (or on every
+ * load when verify is requested).  A file failing the check is
+ * generated again.  Later loads of a verified file only check
+ * the header so mapping it takes milliseconds.  The temporary
+ * file is removed if generating the values throws.
+ */
+template <typename T>
+class cached_dataset {
+   public:
+    static constexpr const char* generator = "uniform01";
+
+    cached_dataset(const std::size_t n, const std::uint64_t seed, const bool verify = false) {
+        namespace fs = std::filesystem;
+        const auto dir  = dataset_directory();
+        const auto name = std::string(generator) + "_" + std::to_string(sizeof(T) * 8) + "_" +
+                          std::to_string(seed) + "_" + std::to_string(n) + ".bin";
+        const auto path = (dir / name).string();
+
+        if (not this->load(path, n, seed, verify)) {
+            fs::create_directories(dir);
+            const auto temp = path + "." + std::to_string(std::random_device()()) + ".tmp";
+            try {
+                xstd::mmap_array<char> file(temp, sizeof(dataset_header) + n * sizeof(T));
+                auto values  = reinterpret_cast<T*>(file.data() + sizeof(dataset_header));
+                auto indices = xstd::range(n);
+                std::for_each(std::execution::par, indices.begin(), indices.end(),
+                              [values, seed](auto i) { values[i] = uniform_value<T>(seed, i); });
+
+                dataset_header header{};
+                std::copy_n(dataset_header::expected_magic, 8, header.magic);
+                header.version    = dataset_header::expected_version;
+                header.value_size = sizeof(T);
+                header.seed       = seed;
+                header.count      = n;
+                header.checksum   = dataset_checksum(values, n);
+                std::strncpy(header.generator, generator, sizeof(header.generator) - 1);
+                std::memcpy(file.data(), &header, sizeof(header));
+                file = xstd::mmap_array<char>();
+                fs::rename(temp, path);
+            } catch (...) {
+                std::error_code ignored;
+                fs::remove(temp, ignored);
+                throw;
+            }
+            if (not this->load(path, n, seed, true)) {
+                throw std::runtime_error("Unable to load dataset " + path);
+            }
+        }
+    }
+
+    const T* begin() const noexcept { return values_; }
+
+    const T* end() const noexcept { return values_ + size_; }
+
+    std::size_t size() const noexcept { return size_; }
+
+   private:
+    xstd::mmap_array<const char> file_;
+    const T* values_  = nullptr;
+    std::size_t size_ = 0;
+
+    /** Record path as verified returning if it already was
+     */
+    static bool verified_before(const std::string& path) {
+        static std::mutex mutex;
+        static std::set<std::string> verified;
+        std::lock_guard<std::mutex> lock(mutex);
+        return not verified.insert(path).second;
+    }
+
+    bool load(const std::string& path, const std::size_t n, const std::uint64_t seed, bool verify) {
+        if (not std::filesystem::exists(path) or
+            std::filesystem::file_size(path) != sizeof(dataset_header) + n * sizeof(T)) {
+            return false;
+        }
+        xstd::mmap_array<const char> file(path);
+        dataset_header header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        const auto values = reinterpret_cast<const T*>(file.data() + sizeof(dataset_header));
+        verify = verify or not verified_before(path);
+        if (not std::equal(header.magic, header.magic + 8, dataset_header::expected_magic) or
+            header.version != dataset_header::expected_version or header.value_size != sizeof(T) or
+            header.seed != seed or header.count != n or std::strncmp(header.generator, generator, 24) != 0 or
+            (verify and header.checksum != dataset_checksum(values, n))) {
+            return false;
+        }
+        file_   = std::move(file);
+        values_ = values;
+        size_   = n;
+        return true;
+    }
+};
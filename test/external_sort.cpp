@@ -0,0 +1,169 @@
+/**
+ * \file       external_sort.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <filesystem>
+#include <functional>
+#include <ios>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/external_sort.hpp"
+#include "xstd/mmap_array.hpp"
+
+/** Functor to Time
+ *
+ * Sorts a file of values larger or smaller than the memory
+ * budget into a second file.
+ */
+class EXTERNAL_SORT {
+   public:
+    using T = double;
+
+    /** Construct the functor
+     */
+    EXTERNAL_SORT(const std::string& input, const std::string& output, const std::size_t budget)
+        : input_(input), output_(output), budget_(budget) {
+        xstd::mmap_array<const T> values(input_);
+        count_ = values.size();
+        sum_   = std::reduce(values.begin(), values.end());
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { std::filesystem::remove(output_); }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        xstd::external_sort<T>(policy, input_, output_, budget_);
+    }
+
+    /** Check for correct solution
+     *
+     * Output must be sorted with the same number and sum of values.
+     *
+     * This should NOT be timed.
+     */
+    bool check() {
+        xstd::mmap_array<const T> values(output_);
+        const auto sum = std::reduce(values.begin(), values.end());
+        return values.size() == count_ and std::is_sorted(values.begin(), values.end()) and
+               std::abs(sum - sum_) <= 1.0e-10 * std::abs(sum_);
+    }
+
+   private:
+    std::string input_;
+    std::string output_;
+    std::size_t budget_;
+    std::size_t count_;
+    T sum_;
+};
+
+/** Number of files in dir
+ */
+std::size_t count_files(const std::filesystem::path& dir) {
+    return std::distance(std::filesystem::directory_iterator(dir), std::filesystem::directory_iterator());
+}
+
+/** Check no temporary runs are left when the sort throws
+ *
+ * The output is in a directory which does not exist so opening
+ * it throws with all runs on disk (input larger than budget).
+ */
+bool check_cleanup(const std::string& input, const std::size_t budget) {
+    const auto temp_dir = std::filesystem::temp_directory_path() / "pstl_external_sort_runs";
+    const auto output   = temp_dir / "missing" / "out.bin";
+    std::filesystem::remove_all(temp_dir);
+    std::filesystem::create_directories(temp_dir);
+
+    bool thrown = false;
+    try {
+        xstd::external_sort<double>(std::execution::seq, input, output.string(), budget, std::less<>(),
+                                    temp_dir.string());
+    } catch (const std::ios_base::failure&) {
+        thrown = true;
+    }
+    const auto left = count_files(temp_dir);
+    std::filesystem::remove_all(temp_dir);
+
+    const bool ok = thrown and (left == 0);
+    std::cout << "Temporary files left after exception = " << left << "  Correct = " << std::boolalpha << ok
+              << std::endl;
+    return ok;
+}
+
+/** Check a traced policy sorts and records the file's values
+ */
+bool check_traced(const std::string& input, const std::string& output, const std::size_t budget) {
+    using xstd::execution::traced;
+    std::filesystem::remove(output);
+    xstd::external_sort<double>(traced(std::execution::par, "external_sort"), input, output, budget);
+
+    xstd::mmap_array<const double> values(output);
+    const auto entries = xstd::trace_registry::instance().entries();
+    const auto found   = entries.find("external_sort");
+    const bool ok      = std::is_sorted(values.begin(), values.end()) and (found != entries.end()) and
+                    (found->second.calls == 1) and (found->second.elements == values.size()) and
+                    (values.size() * sizeof(double) == std::filesystem::file_size(input));
+    std::cout << "Traced external sort: Correct = " << std::boolalpha << ok << std::endl;
+    return ok;
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 3;                 // Number of time to repeat test
+    constexpr std::size_t BUDGET = 16 * 1024 * 1024;  // Memory budget (bytes)
+    const double FACTORS[]       = {0.5, 2.0, 8.0};   // Data size relative to budget
+
+    // Data for problem
+    const auto dir    = std::filesystem::temp_directory_path();
+    const auto input  = (dir / "pstl_external_sort_in.bin").string();
+    const auto output = (dir / "pstl_external_sort_out.bin").string();
+    std::vector<bool> correct;
+
+    for (auto factor : FACTORS) {
+        const std::size_t nsize = factor * BUDGET / sizeof(Real);
+
+        // Initialize Data
+        {
+            std::vector<Real> x(nsize);
+            cached_random_fill(x, 1);
+            xstd::mmap_array<Real> file(input, nsize);
+            std::copy(x.begin(), x.end(), file.begin());
+        }
+
+        // Create Functor
+        EXTERNAL_SORT op(input, output, BUDGET);
+
+        // Calculate Timings
+        std::cout << "Data = " << std::defaultfloat << factor << " x Budget: std::execution::seq\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+
+        std::cout << "Data = " << std::defaultfloat << factor << " x Budget: std::execution::par\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+    }
+
+    correct.push_back(check_cleanup(input, BUDGET));
+    correct.push_back(check_traced(input, output, BUDGET));
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -7,33 +7,34 @@
 
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <execution>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
-#include <random>
+#include <numeric>
 #include <vector>
 #include <type_traits>
 
+#include "xstd/observer.hpp"
+#include "xstd/roofline.hpp"
 #include "xstd/stop_watch.hpp"
+#include "dataset_cache.hpp"
 
 
-/** Function to fill already sized std::vector
+/** Function to fill already sized std::vector from the dataset cache
  *
- * Function to fill already sized std::vector
- * with random values between 0 and 1.  This function
- * is not intended to be timed and no effort has been
- * made to parallelize it.
+ * Function to fill already sized std::vector with random
+ * values between 0 and 1 taken from the dataset cache.  The
+ * values only depend on the seed and size so they are the same
+ * on every run and machine.  They are generated once (in
+ * parallel) and mapped from the cache on later runs.
  */
-template<typename T>
-void random_fill(std::vector<T> &vec) {
-    static_assert(std::is_floating_point_v<T>);
-    std::random_device rd;
-    std::mt19937_64 mre(rd());
-    std::uniform_real_distribution<T> urd(0.0, 1.0);
-    std::for_each(std::begin(vec), std::end(vec), [&](auto& val){
-        val = urd(mre);
-    });
-    // for (auto &val : vec) {
-    //     val = urd(mre);
-    // }
+template<typename T, typename Allocator>
+void cached_random_fill(std::vector<T, Allocator> &vec, const std::uint64_t seed = 0) {
+    cached_dataset<T> dataset(vec.size(), seed);
+    std::copy(std::execution::par, dataset.begin(), dataset.end(), vec.begin());
 }
 
 /** Check if two std::vectors are the same
@@ -41,32 +42,92 @@ void random_fill(std::vector<T> &vec) {
  * This function is not intended to be timed and
  * no effort has been made to parallelize it.
  */
-template <typename T>
-bool check_same(const std::vector<T> &x, const std::vector<T> &y) {
+template <typename T, typename Allocator1, typename Allocator2>
+bool check_same(const std::vector<T, Allocator1> &x, const std::vector<T, Allocator2> &y) {
     return std::equal(x.begin(), x.end(), y.begin());
 }
 
 
+/** Location of the host roofline JSON
+ *
+ * Given by the PSTL_ROOFLINE environment variable or else kept
+ * with the cached datasets.  Written by the roofline test.
+ */
+inline std::filesystem::path roofline_path() {
+    if (const char* path = std::getenv("PSTL_ROOFLINE")) {
+        return path;
+    }
+    return dataset_directory() / "roofline.json";
+}
+
+/** Roofline of the host (empty if it was never measured)
+ */
+inline const xstd::roofline& host_roofline() {
+    static const xstd::roofline roof = []() {
+        std::ifstream file(roofline_path());
+        return file ? xstd::roofline::read_json(file) : xstd::roofline();
+    }();
+    return roof;
+}
+
+/** Detect functors reporting the FLOPs and bytes of one run
+ */
+template <typename T, typename = void>
+struct has_flops_and_bytes : std::false_type {};
+
+template <typename T>
+struct has_flops_and_bytes<T, std::void_t<decltype(std::declval<T&>().flops()), decltype(std::declval<T&>().bytes())>>
+    : std::true_type {};
+
+/** Detect functors with an untimed observed(policy) diagnostic run
+ */
+template <typename T, typename P, typename = void>
+struct has_observed : std::false_type {};
+
+template <typename T, typename P>
+struct has_observed<T, P, std::void_t<decltype(std::declval<T&>().observed(std::declval<const P&>()))>>
+    : std::true_type {};
+
 /** Class to perform timed running of provided Functor
  * 
- * 
+ * The threads of the parallel backend taking part in each run
+ * are displayed next to the time of the run.  Functors with an
+ * observed(policy) method (the timed calculation with its
+ * functions wrapped by xstd::observe) get one more untimed run
+ * per policy displaying the fewest and most elements run by one
+ * thread, the busy time (inside observed calls) of the slowest
+ * and mean thread, their ratio and the total idle time.  The
+ * timed runs are never wrapped and functors without observed()
+ * get no extra run.
+ *
+ * Functors with flops() and bytes() methods (counts for one
+ * run) are placed on the host roofline using the average time:
+ * the achieved rates, arithmetic intensity and the fraction of
+ * the attainable rate at that intensity from main memory on the
+ * most threads taking part in a run (a serial policy is rated
+ * against the single thread roof, not the whole machine).
  */
 struct Runner {
 
     template <std::size_t N, typename P, typename T>
     static bool execute(const P policy, T& functor) {
         xstd::StopWatch watch;
+        xstd::scheduler_observer observer;
 
         std::vector<bool>   correct;
         std::vector<double> times;
+        std::size_t threads = 1;
         for (auto i = 0; i < N; i++) {
 
             functor.reset();
 
             // Time Algorithm
+            observer.reset();
+            observer.start();
             watch.restart();
             functor(policy);
             watch.stop();
+            observer.stop();
 
             // Check Results
             correct.push_back(functor.check());
@@ -76,11 +137,47 @@ struct Runner {
 
             // Display some info
             std::cout << "  Time (sec) = " << std::scientific << times.back();
-            std::cout << "  Correct = " << std::boolalpha << correct.back() << std::endl;
+            std::cout << "  Correct = " << std::boolalpha << correct.back();
+            std::cout << "  Threads = " << observer.threads();
+            std::cout << std::endl;
+            threads = std::max(threads, observer.threads());
         }
         double average = std::accumulate(times.begin(), times.end(), double(0)) / times.size();
         std::cout << "  Average (sec) = " << std::scientific << average << std::endl;
 
+        if constexpr (has_flops_and_bytes<T>::value) {
+            const double flops     = functor.flops();
+            const double bytes     = functor.bytes();
+            const double intensity = flops / bytes;
+            std::cout << "  GFLOP/s = " << std::defaultfloat << flops / average / 1.0e9;
+            std::cout << "  GB/s = " << bytes / average / 1.0e9;
+            std::cout << "  Intensity (FLOP/byte) = " << intensity;
+            if (const auto& roof = host_roofline(); not roof.empty()) {
+                const double attainable = roof.attainable_gflops(intensity, "DRAM", threads);
+                std::cout << "  Roof (GFLOP/s) = " << attainable;
+                std::cout << "  Of Roof = " << 100.0 * flops / average / 1.0e9 / attainable << "%";
+            }
+            std::cout << std::endl;
+        }
+
+        // Untimed run counting and timing the elements of each thread
+        if constexpr (has_observed<T, P>::value) {
+            functor.reset();
+            xstd::parallelism_observer balance(true);
+            balance.start();
+            functor.observed(policy);
+            balance.stop();
+            if (balance.elements() > 0) {
+                std::cout << "  Observed Threads = " << balance.threads();
+                std::cout << "  Elements/Thread = " << balance.min_elements() << "-" << balance.max_elements()
+                          << std::endl;
+                std::cout << "  Busy Max/Mean (sec) = " << std::scientific << balance.busy_max_seconds() << "/"
+                          << balance.busy_mean_seconds();
+                std::cout << "  Imbalance = " << std::defaultfloat << balance.imbalance();
+                std::cout << "  Idle (sec) = " << std::scientific << balance.idle_seconds() << std::endl;
+            }
+        }
+
         return std::all_of(correct.begin(), correct.end(), [](auto val){return val;});
     }
 
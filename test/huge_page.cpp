@@ -0,0 +1,160 @@
+/**
+ * \file       huge_page.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <execution>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/huge_page_allocator.hpp"
+#include "xstd/strided.hpp"
+
+/** Functor to Time
+ *
+ * Same strided SAXPY as strided_stride but with
+ * the storage type as a template parameter.
+ */
+template <typename Vector>
+class STRIDED_SAXPY {
+   public:
+    using T = typename Vector::value_type;
+
+    /** Construct the functor
+     */
+    STRIDED_SAXPY(const T a, const std::vector<T>& x, const std::ptrdiff_t incx, const std::vector<T>& y,
+                  const std::ptrdiff_t incy, const typename Vector::allocator_type& alloc)
+        : incx_(incx),
+          incy_(incy),
+          a_(a),
+          x_(x.begin(), x.end(), alloc),
+          y_(y.begin(), y.end(), alloc),
+          temp_(y.size(), T(0), alloc),
+          answer_(y) {
+        const std::ptrdiff_t x_length = x.size() / incx;
+        const std::ptrdiff_t y_length = y.size() / incy;
+        const std::ptrdiff_t n        = std::min(x_length, y_length);
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+            answer_[i * incy_] += (a_ * x_[i * incx_]);
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { std::copy(y_.begin(), y_.end(), temp_.begin()); }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        auto x_iter = xstd::strided(x_, incx_);
+        auto y_iter = xstd::strided(temp_, incy_);
+        std::transform(policy, x_iter.begin(), x_iter.end(), y_iter.begin(), y_iter.begin(),
+                       [a = this->a_](auto xval, auto yval) { return yval + (a * xval); });
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
+
+    /** Floating point operations of one run (multiply and add)
+     */
+    double flops() const { return 2.0 * std::min(x_.size() / incx_, y_.size() / incy_); }
+
+    /** Bytes moved by one run (read x and y, write y)
+     *
+     * Whole cache lines are moved so strides shorter than a line
+     * also move the values skipped over.
+     */
+    double bytes() const {
+        constexpr std::ptrdiff_t line = 64 / sizeof(T);
+        return 0.5 * this->flops() * sizeof(T) * (std::min(incx_, line) + 2 * std::min(incy_, line));
+    }
+
+    /** Fraction of the arrays backed by huge pages
+     */
+    double huge_page_fraction() const {
+        const double bytes = (x_.size() + y_.size() + temp_.size()) * sizeof(T);
+        return (xstd::huge_page_fraction(x_.data(), x_.size() * sizeof(T)) * x_.size() * sizeof(T) +
+                xstd::huge_page_fraction(y_.data(), y_.size() * sizeof(T)) * y_.size() * sizeof(T) +
+                xstd::huge_page_fraction(temp_.data(), temp_.size() * sizeof(T)) * temp_.size() * sizeof(T)) /
+               bytes;
+    }
+
+   private:
+    std::ptrdiff_t incx_;
+    std::ptrdiff_t incy_;
+    T a_;
+    Vector x_;
+    Vector y_;
+    Vector temp_;
+    std::vector<T> answer_;
+};
+
+/** Time all policies for a storage type
+ */
+template <std::size_t NCYLCE, typename Vector>
+bool run_all(const std::string& name, STRIDED_SAXPY<Vector>& op) {
+    std::vector<bool> correct;
+
+    std::cout << name << ": std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+
+    std::cout << name << ": std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, op));
+
+    std::cout << name << ": std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+
+    std::cout << name << ": std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, op));
+
+    std::cout << name << ": Huge Page Fraction = " << std::fixed << op.huge_page_fraction() << std::endl;
+
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real                    = double;
+    constexpr std::size_t NCYLCE  = 10;       // Number of time to repeat test
+    constexpr std::size_t NSIZE   = 5000000;  // Length of Vectors
+    constexpr std::ptrdiff_t INCX = 2;
+    constexpr std::ptrdiff_t INCY = 3;
+
+    // Data for problem
+    const Real a(5);
+    std::vector<Real> x(NSIZE * INCX);
+    std::vector<Real> y(NSIZE * INCY);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
+
+    // Calculate Timings
+    {
+        STRIDED_SAXPY<std::vector<Real>> op(a, x, INCX, y, INCY, {});
+        correct.push_back(run_all<NCYLCE>("std::vector", op));
+    }
+    {
+        STRIDED_SAXPY<xstd::huge_page_vector<Real>> op(a, x, INCX, y, INCY, xstd::huge_page_allocator<Real>(false));
+        correct.push_back(run_all<NCYLCE>("Transparent Huge Pages", op));
+    }
+    {
+        STRIDED_SAXPY<xstd::huge_page_vector<Real>> op(a, x, INCX, y, INCY, xstd::huge_page_allocator<Real>(true));
+        correct.push_back(run_all<NCYLCE>("Explicit Huge Pages", op));
+    }
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -0,0 +1,166 @@
+/**
+ * \file       iterator_conformance.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <execution>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<tbb/task_arena.h>) && __has_include(<tbb/global_control.h>)
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#define HAVE_TBB_ARENA 1
+#else
+#define HAVE_TBB_ARENA 0
+#endif
+
+#include "xstd/observer.hpp"
+#include "xstd/range.hpp"
+#include "xstd/storage_cast.hpp"
+#include "xstd/strided.hpp"
+#include "xstd/zip.hpp"
+
+/** Iterator the parallel backends will split across threads
+ *
+ * The C++20 concept checks the full random access interface
+ * while the PSTL backends dispatch on the iterator_category
+ * and silently run anything less than random access serially.
+ */
+template <typename Iterator>
+constexpr bool parallel_ready =
+    std::random_access_iterator<Iterator> and
+    std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>;
+
+using vector_iterator = std::vector<double>::iterator;
+
+static_assert(parallel_ready<xstd::range_iterator<std::size_t>>);
+static_assert(parallel_ready<xstd::range_iterator<int>>);
+static_assert(parallel_ready<xstd::strided_iterator<vector_iterator>>);
+static_assert(parallel_ready<xstd::strided_iterator<std::vector<double>::const_iterator>>);
+static_assert(parallel_ready<xstd::zip_iterator<vector_iterator, vector_iterator>>);
+static_assert(parallel_ready<xstd::zip_iterator<vector_iterator, xstd::strided_iterator<vector_iterator>>>);
+static_assert(parallel_ready<xstd::storage_iterator<std::vector<float>::iterator, double>>);
+static_assert(parallel_ready<xstd::strided_iterator<xstd::storage_iterator<std::vector<float>::iterator, double>>>);
+
+/** Number of threads which ran the elements of a std::for_each
+ *
+ * Every element sleeps briefly so idle threads get the chance
+ * to steal work even when there are fewer cores than threads.
+ * The threads joining the scheduler must include every thread
+ * which ran elements.
+ */
+template <typename Policy, typename Iterator>
+std::size_t threads_used(const Policy policy, Iterator first, Iterator last) {
+    xstd::parallelism_observer observer;
+    xstd::scheduler_observer scheduler;
+    scheduler.start();
+    observer.start();
+    std::for_each(policy, first, last,
+                  xstd::observe([](auto&&) { std::this_thread::sleep_for(std::chrono::microseconds(20)); }));
+    observer.stop();
+    scheduler.stop();
+    return (scheduler.threads() >= observer.threads()) ? observer.threads() : 0;
+}
+
+/** Check every policy runs as expected over [first, last)
+ *
+ * seq must use one thread and the parallel policies more than
+ * one when a parallel backend is available.
+ */
+template <typename Iterator>
+bool check_policies(const std::string& name, Iterator first, Iterator last) {
+    const std::size_t nseq        = threads_used(std::execution::seq, first, last);
+    const std::size_t npar        = threads_used(std::execution::par, first, last);
+    const std::size_t npar_unseq  = threads_used(std::execution::par_unseq, first, last);
+    const std::size_t min_threads = HAVE_TBB_ARENA ? 2 : 1;
+
+    const bool correct = (nseq == 1) and (npar >= min_threads) and (npar_unseq >= min_threads);
+    std::cout << name << ": std::execution::seq       Threads = " << nseq << "\n";
+    std::cout << name << ": std::execution::par       Threads = " << npar << "\n";
+    std::cout << name << ": std::execution::par_unseq Threads = " << npar_unseq << "\n";
+    std::cout << name << ": Correct = " << std::boolalpha << correct << std::endl;
+    return correct;
+}
+
+/** Check observers stopped out of order leave the chain intact
+ *
+ * Stopping the first of two running observers must leave the
+ * second recording, and once both are destroyed observed calls
+ * must not reach either of them.
+ */
+bool check_stop_order(const std::vector<double>& y) {
+    auto touch = xstd::observe([](auto&&) {});
+    bool ok    = true;
+    {
+        xstd::parallelism_observer first;
+        xstd::parallelism_observer second;
+        first.start();
+        second.start();
+        first.stop();
+        std::for_each(y.begin(), y.end(), touch);
+        ok = (first.elements() == 0) and (second.elements() == y.size());
+        second.stop();
+    }
+    ok = ok and (xstd::detail::active_observer.load() == nullptr);
+    std::for_each(y.begin(), y.end(), touch);
+
+    xstd::parallelism_observer after;
+    after.start();
+    std::for_each(y.begin(), y.end(), touch);
+    after.stop();
+    ok = ok and (after.elements() == y.size());
+    std::cout << "Observers stopped out of order: Correct = " << std::boolalpha << ok << std::endl;
+    return ok;
+}
+
+//
+// MAIN Function
+//
+int main() {
+    constexpr std::size_t NTHREAD = 4;     // Threads of the arena
+    constexpr std::size_t NSIZE   = 4096;  // Length of Vectors
+
+    // Data for problem
+    std::vector<double> x(2 * NSIZE);
+    std::vector<double> y(NSIZE);
+    std::vector<float> z(NSIZE);
+    std::vector<bool> correct;
+
+    auto run = [&]() {
+        auto r = xstd::range(NSIZE);
+        correct.push_back(check_policies("std::vector", y.begin(), y.end()));
+        correct.push_back(check_policies("xstd::range", r.begin(), r.end()));
+
+        auto s = xstd::strided(x, 2);
+        correct.push_back(check_policies("xstd::strided", s.begin(), s.end()));
+
+        auto zy = xstd::zip(y, s);
+        correct.push_back(check_policies("xstd::zip", zy.begin(), zy.end()));
+
+        auto c = xstd::storage_cast<double>(z);
+        correct.push_back(check_policies("xstd::storage_cast", c.begin(), c.end()));
+    };
+
+    // Use an arena with several threads (allowed beyond the core
+    // count) so machines with a single core still show if the
+    // work was split
+#if HAVE_TBB_ARENA
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, NTHREAD);
+    tbb::task_arena arena(NTHREAD);
+    arena.execute(run);
+#else
+    (void)NTHREAD;
+    run();
+#endif
+    correct.push_back(check_stop_order(y));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
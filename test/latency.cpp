@@ -0,0 +1,202 @@
+/**
+ * \file       latency.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#endif
+
+#include "helpers.hpp"
+#include "xstd/stop_watch.hpp"
+
+/** Median and 99th percentile of repeated calls
+ */
+struct latency {
+    double median = 0;
+    double p99    = 0;
+};
+
+/** Time nrep calls of body after a few untimed warm up calls
+ *
+ * Each call is timed on its own so the spread shows and not
+ * only the mean.
+ */
+template <typename Body>
+latency measure_latency(const std::size_t nrep, Body&& body) {
+    constexpr std::size_t NWARM = 20;
+    for (std::size_t i = 0; i < NWARM; ++i) {
+        body();
+    }
+
+    xstd::StopWatch watch;
+    std::vector<double> times(nrep);
+    for (auto& time : times) {
+        watch.restart();
+        body();
+        watch.stop();
+        time = watch.elapsed_seconds();
+    }
+    std::sort(times.begin(), times.end());
+    return {times[nrep / 2], times[std::min(nrep - 1, (99 * nrep) / 100)]};
+}
+
+/** Name of the host the benchmark ran on
+ */
+std::string host_name() {
+#if __has_include(<unistd.h>)
+    char name[256] = {};
+    if (::gethostname(name, sizeof(name) - 1) == 0) {
+        return name;
+    }
+#endif
+    return "unknown";
+}
+
+/** Time one algorithm for every size under each policy
+ *
+ * Prints the median and p99 of each and then the fixed overhead
+ * of each policy (its median at the smallest size less the seq
+ * median) and the crossover: the smallest size from which it
+ * beats seq at every larger size.
+ */
+template <typename Algorithm>
+bool run_algorithm(const std::string& name, const std::vector<std::size_t>& sizes, const std::size_t nrep,
+                   Algorithm&& algorithm) {
+    const std::vector<std::string> policies = {"seq", "unseq", "par", "par_unseq"};
+    std::map<std::string, std::vector<latency>> results;
+    bool correct = true;
+
+    for (const auto n : sizes) {
+        std::vector<double> x(n);
+        std::vector<double> y(n);
+        cached_random_fill(x, 1);
+
+        auto run = [&](const auto policy, const std::string& policy_name) {
+            algorithm.reset(x, y);
+            const auto lat = measure_latency(nrep, [&]() { algorithm(policy, x, y); });
+            correct        = correct and algorithm.check(x, y);
+            results[policy_name].push_back(lat);
+            std::cout << name << " N=" << n << ": std::execution::" << policy_name << "  Median (sec) = "
+                      << std::scientific << lat.median << "  p99 (sec) = " << lat.p99 << std::endl;
+        };
+        run(std::execution::seq, "seq");
+        run(std::execution::unseq, "unseq");
+        run(std::execution::par, "par");
+        run(std::execution::par_unseq, "par_unseq");
+    }
+
+    const auto& seq = results["seq"];
+    for (const auto& policy : policies) {
+        const auto& lat       = results[policy];
+        const double overhead = lat.front().median - seq.front().median;
+        std::size_t crossover = 0;
+        for (std::size_t i = sizes.size(); i-- > 0 and lat[i].median < seq[i].median;) {
+            crossover = sizes[i];
+        }
+        std::cout << name << ": std::execution::" << policy << "  Fixed Overhead (sec) = " << std::scientific
+                  << overhead << "  Crossover N = ";
+        if (policy == "seq") {
+            std::cout << "-";
+        } else if (crossover > 0) {
+            std::cout << crossover;
+        } else {
+            std::cout << "none up to " << sizes.back();
+        }
+        std::cout << std::endl;
+    }
+    return correct;
+}
+
+/** Kernels to time
+ *
+ * Each calls one algorithm with the given policy and can check
+ * the result of its last call.  Kernels updating in place also
+ * reset the data before each measurement.
+ */
+struct EMPTY_FOR_EACH {
+    void reset(const std::vector<double>&, std::vector<double>&) const {}
+
+    template <typename Policy>
+    void operator()(const Policy policy, std::vector<double>& x, std::vector<double>&) const {
+        std::for_each(policy, x.begin(), x.end(), [](double&) {});
+    }
+    bool check(const std::vector<double>&, const std::vector<double>&) const { return true; }
+};
+
+struct TRIVIAL_FOR_EACH {
+    mutable std::size_t calls = 0;
+
+    void reset(const std::vector<double>& x, std::vector<double>& y) const {
+        std::copy(x.begin(), x.end(), y.begin());
+        calls = 0;
+    }
+
+    template <typename Policy>
+    void operator()(const Policy policy, std::vector<double>&, std::vector<double>& y) const {
+        std::for_each(policy, y.begin(), y.end(), [](double& v) { v += 1; });
+        ++calls;
+    }
+    bool check(const std::vector<double>& x, const std::vector<double>& y) const {
+        return std::equal(x.begin(), x.end(), y.begin(),
+                          [n = double(calls)](double u, double v) { return std::abs(u + n - v) <= 1.0e-9 * n; });
+    }
+};
+
+struct TRIVIAL_TRANSFORM {
+    void reset(const std::vector<double>&, std::vector<double>&) const {}
+
+    template <typename Policy>
+    void operator()(const Policy policy, std::vector<double>& x, std::vector<double>& y) const {
+        std::transform(policy, x.begin(), x.end(), y.begin(), [](double v) { return 2 * v; });
+    }
+    bool check(const std::vector<double>& x, const std::vector<double>& y) const {
+        return std::equal(x.begin(), x.end(), y.begin(), [](double u, double v) { return 2 * u == v; });
+    }
+};
+
+struct TRIVIAL_REDUCE {
+    mutable double sum = 0;
+
+    void reset(const std::vector<double>&, std::vector<double>&) const {}
+
+    template <typename Policy>
+    void operator()(const Policy policy, std::vector<double>& x, std::vector<double>&) const {
+        sum = std::reduce(policy, x.begin(), x.end(), 0.0);
+    }
+    bool check(const std::vector<double>& x, const std::vector<double>&) const {
+        const double answer = std::accumulate(x.begin(), x.end(), 0.0);
+        return std::abs(sum - answer) <= 1.0e-12 * std::abs(answer);
+    }
+};
+
+//
+// MAIN Function
+//
+int main() {
+    constexpr std::size_t NREP = 2000;  // Timed calls per size and policy
+
+    const std::vector<std::size_t> sizes = {100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000};
+    std::vector<bool> correct;
+
+    std::cout << "Host: " << host_name() << "  Threads: " << std::thread::hardware_concurrency() << std::endl;
+
+    correct.push_back(run_algorithm("for_each(empty)", sizes, NREP, EMPTY_FOR_EACH()));
+    correct.push_back(run_algorithm("for_each(trivial)", sizes, NREP, TRIVIAL_FOR_EACH()));
+    correct.push_back(run_algorithm("transform(trivial)", sizes, NREP, TRIVIAL_TRANSFORM()));
+    correct.push_back(run_algorithm("reduce", sizes, NREP, TRIVIAL_REDUCE()));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
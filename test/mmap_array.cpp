@@ -0,0 +1,139 @@
+/**
+ * \file       mmap_array.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/mmap_array.hpp"
+#include "xstd/uninitialized.hpp"
+
+/** How the file is brought into memory
+ */
+enum class input { read, mapped, populate, prefault };
+
+/** Functor to Time
+ *
+ * Sum of a binary file of values.  Each timed run opens the
+ * file again either reading it into a vector before reducing
+ * it or reducing it directly from a mapping (optionally
+ * populated while mapping or advised and prefaulted in
+ * parallel).
+ */
+template <input Input>
+class FILE_REDUCE {
+   public:
+    using T = double;
+
+    /** Construct the functor
+     */
+    FILE_REDUCE(const std::string& path, const T answer) : path_(path), answer_(answer), sum_(0) {}
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { sum_ = 0; }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        if constexpr (Input == input::read) {
+            std::ifstream file(path_, std::ios::binary | std::ios::ate);
+            xstd::uninitialized_vector<T> values(file.tellg() / sizeof(T));
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+            sum_ = std::reduce(policy, values.begin(), values.end());
+        } else {
+            const auto load = (Input == input::populate) ? xstd::map_load::populate : xstd::map_load::lazy;
+            xstd::mmap_array<const T> values(path_, load);
+            if constexpr (Input == input::prefault) {
+                values.advise(xstd::map_advice::sequential);
+                values.prefault(policy);
+            }
+            sum_ = std::reduce(policy, values.begin(), values.end());
+        }
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::abs(sum_ - answer_) <= 1.0e-10 * std::abs(answer_); }
+
+   private:
+    std::string path_;
+    T answer_;
+    T sum_;
+};
+
+/** Time functor under seq and par
+ */
+template <std::size_t NCYLCE, input Input>
+bool run_all(const std::string& name, FILE_REDUCE<Input> op) {
+    std::vector<bool> correct;
+
+    std::cout << name << ": std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+
+    std::cout << name << ": std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;        // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 50000000;  // Length of Vectors
+
+    // Data for problem
+    const auto path = (std::filesystem::temp_directory_path() / "pstl_mmap_array.bin").string();
+    std::vector<Real> x(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+    const Real answer = std::accumulate(x.begin(), x.end(), Real(0));
+
+    // Write the file through a read-write mapping
+    {
+        xstd::mmap_array<Real> file(path, NSIZE);
+        std::copy(std::execution::par, x.begin(), x.end(), file.begin());
+    }
+
+    // A size given as an int literal creates the file
+    {
+        const auto created = (std::filesystem::temp_directory_path() / "pstl_mmap_array_created.bin").string();
+        std::filesystem::remove(created);
+        const bool ok = xstd::mmap_array<Real>(created, 1000).size() == 1000 and
+                        std::filesystem::file_size(created) == 1000 * sizeof(Real);
+        std::filesystem::remove(created);
+        std::cout << "Created from int size: Correct = " << std::boolalpha << ok << std::endl;
+        correct.push_back(ok);
+    }
+
+    // Calculate Timings
+    correct.push_back(run_all<NCYLCE>("read + reduce", FILE_REDUCE<input::read>(path, answer)));
+    correct.push_back(run_all<NCYLCE>("mmap + reduce", FILE_REDUCE<input::mapped>(path, answer)));
+    correct.push_back(run_all<NCYLCE>("mmap(populate) + reduce", FILE_REDUCE<input::populate>(path, answer)));
+    correct.push_back(run_all<NCYLCE>("mmap + prefault + reduce", FILE_REDUCE<input::prefault>(path, answer)));
+
+    std::filesystem::remove(path);
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
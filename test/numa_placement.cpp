@@ -0,0 +1,132 @@
+/**
+ * \file       numa_placement.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <execution>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/numa_allocator.hpp"
+#include "xstd/uninitialized.hpp"
+
+/** Functor to Time
+ *
+ * SAXPY on arrays whose pages are placed by a NUMA policy.
+ * The arrays are first touched in parallel so the local
+ * policy places each page on the node of the writing thread.
+ */
+template <typename T>
+class NUMA_SAXPY {
+   public:
+    using allocator_type = xstd::default_init_allocator<T, xstd::numa_allocator<T>>;
+    using vector_type    = std::vector<T, allocator_type>;
+
+    /** Construct the functor
+     */
+    NUMA_SAXPY(const T a, const std::vector<T>& x, const std::vector<T>& y, const allocator_type& alloc)
+        : a_(a), x_(x.size(), alloc), y_(y.size(), alloc), temp_(y.size(), alloc), answer_(y) {
+        xstd::uninitialized_copy(std::execution::par, x.begin(), x.end(), x_.begin());
+        xstd::uninitialized_copy(std::execution::par, y.begin(), y.end(), y_.begin());
+        xstd::uninitialized_copy(std::execution::par, y.begin(), y.end(), temp_.begin());
+        for (std::size_t i = 0; i < x_.size(); ++i) {
+            answer_[i] += (a_ * x_[i]);
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { std::copy(std::execution::par, y_.begin(), y_.end(), temp_.begin()); }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        std::transform(policy, x_.begin(), x_.end(), temp_.begin(), temp_.begin(),
+                       [a = this->a_](auto xi, auto yi) { return yi + (a * xi); });
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
+
+    /** Floating point operations of one run (multiply and add)
+     */
+    double flops() const { return 2.0 * x_.size(); }
+
+    /** Bytes moved by one run (read x and y, write y)
+     */
+    double bytes() const { return 3.0 * sizeof(T) * x_.size(); }
+
+    /** Display number of pages of y on each node
+     */
+    void print_placement() const {
+        std::cout << "  Pages per Node =";
+        for (auto [node, count] : xstd::numa_node_histogram(temp_.data(), temp_.size() * sizeof(T))) {
+            std::cout << "  " << node << ":" << count;
+        }
+        std::cout << std::endl;
+    }
+
+   private:
+    T a_;
+    vector_type x_;
+    vector_type y_;
+    vector_type temp_;
+    std::vector<T> answer_;
+};
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;        // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 20000000;  // Length of Vectors
+
+    // Data for problem
+    const Real a(5);
+    std::vector<Real> x(NSIZE);
+    std::vector<Real> y(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
+
+    std::cout << "NUMA Nodes = " << xstd::numa_node_count() << std::endl;
+
+    const std::pair<std::string, xstd::numa_policy> policies[] = {{"Local", xstd::numa_policy::local},
+                                                                  {"Interleave", xstd::numa_policy::interleave},
+                                                                  {"Block", xstd::numa_policy::block}};
+
+    for (auto& [name, placement] : policies) {
+        NUMA_SAXPY<Real> op(a, x, y, xstd::numa_allocator<Real>(placement));
+
+        std::cout << name << ": Placement\n";
+        op.print_placement();
+
+        // Calculate Timings
+        std::cout << name << ": std::execution::seq\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+
+        std::cout << name << ": std::execution::unseq\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, op));
+
+        std::cout << name << ": std::execution::par\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+
+        std::cout << name << ": std::execution::par_unseq\n";
+        correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, op));
+    }
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -0,0 +1,111 @@
+/**
+ * \file       per_thread.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/per_thread.hpp"
+#include "xstd/stop_watch.hpp"
+
+/** Seconds for nthreads std::threads to each count to ncount
+ *
+ * counter(t) returns the counter of thread t.  Every increment
+ * is a volatile store so each one reaches the cache and adjacent
+ * counters of different threads fight over the same line.
+ */
+template <typename Counter>
+double count_seconds(const std::size_t nthreads, const std::size_t ncount, Counter&& counter) {
+    xstd::StopWatch watch;
+    watch.start();
+    std::vector<std::thread> team;
+    for (std::size_t t = 0; t < nthreads; ++t) {
+        team.emplace_back([&, t]() {
+            volatile std::size_t& count = counter(t);
+            for (std::size_t i = 0; i < ncount; ++i) {
+                count = count + 1;
+            }
+        });
+    }
+    for (auto& thread : team) {
+        thread.join();
+    }
+    watch.stop();
+    return watch.elapsed_seconds();
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;         // Number of time to repeat test
+    constexpr std::size_t NCOUNT = 50000000;   // Increments per thread
+    constexpr std::size_t NSIZE  = 20000000;   // Length of Vectors
+    const std::size_t NTHREAD    = std::max(2U, std::thread::hardware_concurrency());
+
+    std::vector<bool> correct;
+
+    // False sharing: adjacent counters against padded per_thread slots
+    // (a thread starting after another exited may reuse its slot)
+    for (std::size_t cycle = 0; cycle < NCYLCE; ++cycle) {
+        std::vector<std::size_t> adjacent(NTHREAD, 0);
+        const double shared = count_seconds(NTHREAD, NCOUNT, [&](std::size_t t) -> std::size_t& { return adjacent[t]; });
+
+        xstd::per_thread<std::size_t> padded;
+        const double local = count_seconds(NTHREAD, NCOUNT, [&](std::size_t) -> std::size_t& { return padded.local(); });
+
+        const bool ok = std::all_of(adjacent.begin(), adjacent.end(), [](auto c) { return c == NCOUNT; }) and
+                        (padded.size() >= 1) and (padded.size() <= NTHREAD) and (padded.combine(std::plus<>()) == NTHREAD * NCOUNT);
+        correct.push_back(ok);
+        std::cout << "Counters (" << NTHREAD << " threads): Adjacent (sec) = " << std::scientific << shared
+                  << "  Padded (sec) = " << local << "  Speedup = " << std::defaultfloat << shared / local
+                  << "  Correct = " << std::boolalpha << ok << std::endl;
+    }
+
+    // Partial sums from the threads of the parallel algorithms
+    std::vector<Real> x(NSIZE);
+    cached_random_fill(x, 1);
+    const Real answer = std::accumulate(x.begin(), x.end(), Real(0), [](Real s, Real v) { return s + v * v; });
+
+    auto run = [&](const auto policy, const std::string& name) {
+        xstd::per_thread<Real> partial;
+        xstd::StopWatch watch;
+        watch.start();
+        std::for_each(policy, x.begin(), x.end(), [&](Real v) { partial.local() += v * v; });
+        const Real sum = partial.combine(std::plus<>());
+        watch.stop();
+        const bool ok = std::abs(sum - answer) <= 1.0e-10 * answer;
+        std::cout << "Sum of squares: std::execution::" << name << "  Time (sec) = " << std::scientific
+                  << watch.elapsed_seconds() << "  Threads = " << partial.size() << "  Correct = " << std::boolalpha
+                  << ok << std::endl;
+        return ok;
+    };
+    correct.push_back(run(std::execution::seq, "seq"));
+    correct.push_back(run(std::execution::par, "par"));
+
+    // Values created from a factory and visited with for_each
+    xstd::per_thread<std::vector<int>> lists([]() { return std::vector<int>(1, -1); });
+    std::vector<std::thread> team;
+    for (std::size_t t = 0; t < NTHREAD; ++t) {
+        team.emplace_back([&, t]() { lists.local().push_back(int(t)); });
+    }
+    for (auto& thread : team) {
+        thread.join();
+    }
+    std::size_t total = 0;
+    lists.for_each([&](const std::vector<int>& list) { total += list.size(); });
+    correct.push_back(total == lists.size() + NTHREAD);
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
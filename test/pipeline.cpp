@@ -0,0 +1,226 @@
+/**
+ * \file       pipeline.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <execution>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/pipeline.hpp"
+#include "xstd/range.hpp"
+
+/** Stages shared by both functors
+ *
+ * decode    : Unpack quantized values into doubles
+ * transform : Apply a point wise function
+ * reduce    : Accumulate the sum of values
+ * encode    : Store values back as float
+ */
+template <typename T>
+struct Stages {
+    T scale;
+    T offset;
+
+    T decode(const std::int16_t q) const { return offset + scale * q; }
+
+    T transform(const T w) const { return w * w + T(1); }
+
+    float encode(const T w) const { return static_cast<float>(w); }
+};
+
+/** Relative comparison of two sums
+ */
+template <typename T>
+bool nearly_equal(const T a, const T b) {
+    return std::abs(a - b) <= 1.0e-10 * std::max(std::abs(a), std::abs(b));
+}
+
+/** Functor to Time each stage sweeping the full array
+ */
+template <typename T>
+class SWEEP {
+   public:
+    /** Construct the functor
+     */
+    SWEEP(const Stages<T>& stages, const std::vector<std::int16_t>& q)
+        : stages_(stages), q_(q), w_(q.size()), answer_(q.size()) {
+        answer_sum_ = 0;
+        for (std::size_t i = 0; i < q_.size(); ++i) {
+            const T w = stages_.transform(stages_.decode(q_[i]));
+            answer_sum_ += w;
+            answer_[i] = stages_.encode(w);
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() {
+        sum_ = 0;
+        out_.assign(q_.size(), 0);
+    }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        std::transform(policy, q_.begin(), q_.end(), w_.begin(), [s = this->stages_](auto q) { return s.decode(q); });
+        std::transform(policy, w_.begin(), w_.end(), w_.begin(), [s = this->stages_](auto w) { return s.transform(w); });
+        sum_ = std::reduce(policy, w_.begin(), w_.end(), T(0));
+        std::transform(policy, w_.begin(), w_.end(), out_.begin(), [s = this->stages_](auto w) { return s.encode(w); });
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return nearly_equal(sum_, answer_sum_) and std::equal(answer_.begin(), answer_.end(), out_.begin()); }
+
+   private:
+    Stages<T> stages_;
+    std::vector<std::int16_t> q_;
+    std::vector<T> w_;
+    std::vector<float> out_;
+    std::vector<float> answer_;
+    T sum_;
+    T answer_sum_;
+};
+
+/** Functor to Time each chunk flowing through all stages
+ */
+template <typename T>
+class PIPELINE {
+   public:
+    /** Construct the functor
+     */
+    PIPELINE(const Stages<T>& stages, const std::vector<std::int16_t>& q, const xstd::pipeline& pipe)
+        : stages_(stages), q_(q), pipe_(pipe), answer_(q.size()) {
+        answer_sum_ = 0;
+        for (std::size_t i = 0; i < q_.size(); ++i) {
+            const T w = stages_.transform(stages_.decode(q_[i]));
+            answer_sum_ += w;
+            answer_[i] = stages_.encode(w);
+        }
+
+        // One chunk buffer for each chunk in flight
+        chunk_ = pipe_.chunk_size<T>();
+        buffers_.resize(pipe_.max_in_flight(), std::vector<T>(chunk_));
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() {
+        sum_ = 0;
+        out_.assign(q_.size(), 0);
+    }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        const std::ptrdiff_t n = q_.size();
+
+        auto buffer = [this](auto first) -> std::vector<T>& {
+            return buffers_[(*first / chunk_) % buffers_.size()];
+        };
+
+        auto decode = [&](auto first, auto last) {
+            std::transform(policy, q_.begin() + *first, q_.begin() + *last, buffer(first).begin(),
+                           [s = this->stages_](auto q) { return s.decode(q); });
+        };
+        auto transform = [&](auto first, auto last) {
+            auto& w = buffer(first);
+            std::transform(policy, w.begin(), w.begin() + (last - first), w.begin(),
+                           [s = this->stages_](auto w) { return s.transform(w); });
+        };
+        auto reduce = [&](auto first, auto last) {
+            auto& w = buffer(first);
+            sum_ += std::reduce(policy, w.begin(), w.begin() + (last - first), T(0));
+        };
+        auto encode = [&](auto first, auto last) {
+            auto& w = buffer(first);
+            std::transform(policy, w.begin(), w.begin() + (last - first), out_.begin() + *first,
+                           [s = this->stages_](auto w) { return s.encode(w); });
+        };
+
+        pipe_.run(xstd::range(n), decode, transform, reduce, encode);
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return nearly_equal(sum_, answer_sum_) and std::equal(answer_.begin(), answer_.end(), out_.begin()); }
+
+   private:
+    Stages<T> stages_;
+    std::vector<std::int16_t> q_;
+    xstd::pipeline pipe_;
+    std::size_t chunk_;
+    std::vector<std::vector<T>> buffers_;
+    std::vector<float> out_;
+    std::vector<float> answer_;
+    T sum_;
+    T answer_sum_;
+};
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE    = 10;        // Number of time to repeat test
+    constexpr std::size_t NSIZE     = 20000000;  // Length of Vectors
+    constexpr std::size_t NINFLIGHT = 4;         // One chunk per stage
+
+    // Data for problem
+    const Stages<Real> stages{Real(1) / 1024, Real(-4)};
+    std::vector<Real> u(NSIZE);
+    std::vector<std::int16_t> q(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(u, 1);
+    std::transform(u.begin(), u.end(), q.begin(), [](auto val) { return static_cast<std::int16_t>(8192 * val); });
+
+    // Create Functors
+    SWEEP<Real> sweep(stages, q);
+    PIPELINE<Real> pipe(stages, q, xstd::pipeline(0, NINFLIGHT));
+
+    // Calculate Timings
+    std::cout << "Full Sweeps: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, sweep));
+
+    std::cout << "Pipeline: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, pipe));
+
+    std::cout << "Full Sweeps: std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, sweep));
+
+    std::cout << "Pipeline: std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, pipe));
+
+    std::cout << "Full Sweeps: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, sweep));
+
+    std::cout << "Pipeline: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, pipe));
+
+    std::cout << "Full Sweeps: std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, sweep));
+
+    std::cout << "Pipeline: std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, pipe));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -0,0 +1,133 @@
+/**
+ * \file       pool_allocator.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <execution>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/pool_allocator.hpp"
+#include "xstd/range.hpp"
+
+/** Functor to Time
+ *
+ * Mimics per column work lists of a model.  Each column builds
+ * a small vector of varying length inside a parallel loop.  The
+ * lists are kept and later consumed and released by a second
+ * parallel loop running in the opposite order so many blocks are
+ * freed by a thread other than the one that allocated them.
+ */
+template <template <typename> class Allocator>
+class WORK_LISTS {
+   public:
+    using T          = double;
+    using list_type  = std::vector<T, Allocator<T>>;
+    using lists_type = std::vector<list_type, Allocator<list_type>>;
+
+    /** Construct the functor
+     */
+    WORK_LISTS(const std::vector<T>& x, const std::size_t ncol) : x_(x), ncol_(ncol), sums_(ncol), answer_(ncol) {
+        for (std::size_t col = 0; col < ncol_; ++col) {
+            const auto first = x_.begin() + this->offset(col);
+            answer_[col]     = std::accumulate(first, first + this->length(col), T(0));
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { std::fill(sums_.begin(), sums_.end(), T(0)); }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        auto cols = xstd::range(ncol_);
+        lists_type lists(ncol_);
+
+        // Build the work list of each column
+        std::for_each(policy, cols.begin(), cols.end(), [&](auto col) {
+            const auto first = x_.begin() + this->offset(col);
+            lists[col].assign(first, first + this->length(col));
+        });
+
+        // Consume and release the lists in reverse order
+        std::for_each(policy, cols.begin(), cols.end(), [&](auto i) {
+            const auto col = ncol_ - 1 - i;
+            sums_[col]     = std::accumulate(lists[col].begin(), lists[col].end(), T(0));
+            list_type().swap(lists[col]);
+        });
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(answer_.begin(), answer_.end(), sums_.begin()); }
+
+   private:
+    std::vector<T> x_;
+    std::size_t ncol_;
+    std::vector<T> sums_;
+    std::vector<T> answer_;
+
+    // Lengths between 1 and 64 values (8 to 512 bytes)
+    std::size_t length(const std::size_t col) const { return 1 + (col * 7919) % 64; }
+
+    std::size_t offset(const std::size_t col) const { return (col * 104729) % (x_.size() - 64); }
+};
+
+/** Pool memory released by a static destructor at exit
+ *
+ * Runs after the main thread's pool cache was returned so the
+ * blocks must take the remote free path.
+ */
+std::vector<std::vector<int, xstd::pool_allocator<int>>> released_at_exit;
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;       // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 1000000;  // Length of source data
+    constexpr std::size_t NCOL   = 1000000;  // Number of columns
+
+    // Data for problem
+    std::vector<Real> x(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+
+    for (int i = 0; i < 1000; ++i) {
+        released_at_exit.emplace_back(std::size_t(1 + i % 200), i);
+    }
+
+    // Create Functors
+    WORK_LISTS<std::allocator> malloc_lists(x, NCOL);
+    WORK_LISTS<xstd::pool_allocator> pool_lists(x, NCOL);
+
+    // Calculate Timings
+    std::cout << "std::allocator: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, malloc_lists));
+
+    std::cout << "std::allocator: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, malloc_lists));
+
+    std::cout << "xstd::pool_allocator: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, pool_lists));
+
+    std::cout << "xstd::pool_allocator: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, pool_lists));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
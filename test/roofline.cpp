@@ -0,0 +1,65 @@
+/**
+ * \file       roofline.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/roofline.hpp"
+
+//
+// MAIN Function
+//
+int main() {
+    std::vector<bool> correct;
+
+    // Measure the host
+    const auto roof = xstd::roofline::measure();
+    for (const auto& rate : roof.compute) {
+        std::cout << "Multiply-Add: " << rate.kernel << "(" << rate.width << ") Threads = " << rate.threads
+                  << "  GFLOP/s = " << std::defaultfloat << rate.gflops << "\n";
+    }
+    for (const auto& rate : roof.bandwidth) {
+        std::cout << "Bandwidth: " << rate.level << " (" << rate.bytes << " bytes) Threads = " << rate.threads
+                  << "  Read/Write/Triad/Update (GB/s) = " << std::defaultfloat << rate.read_gbs << "/"
+                  << rate.write_gbs << "/" << rate.triad_gbs << "/" << rate.update_gbs << "\n";
+    }
+    std::cout << "Peak GFLOP/s = " << roof.peak_gflops() << "  Peak DRAM GB/s = " << roof.peak_bandwidth_gbs()
+              << std::endl;
+    correct.push_back(roof.peak_gflops() > 0 and roof.peak_bandwidth_gbs() > 0);
+
+    // Every rate must survive the trip through JSON
+    std::stringstream json;
+    json << roof;
+    const auto read = xstd::roofline::read_json(json);
+    auto close      = [](double a, double b) { return std::abs(a - b) <= 1.0e-5 * std::abs(b); };
+    correct.push_back(read.compute.size() == roof.compute.size() and
+                      read.bandwidth.size() == roof.bandwidth.size());
+    correct.push_back(close(read.peak_gflops(), roof.peak_gflops()));
+    correct.push_back(close(read.peak_bandwidth_gbs("L1"), roof.peak_bandwidth_gbs("L1")));
+    correct.push_back(close(read.peak_bandwidth_gbs(), roof.peak_bandwidth_gbs()));
+
+    // Runs are rated on the roof of the nearest measured thread count
+    xstd::roofline rows;
+    rows.compute   = {{"scalar", 1, 1, 2.0}, {"scalar", 1, 4, 8.0}};
+    rows.bandwidth = {{"DRAM", 0, 1, 10.0, 0, 0, 0}, {"DRAM", 0, 4, 30.0, 0, 0, 0}};
+    correct.push_back(rows.nearest_threads(1) == 1 and rows.nearest_threads(3) == 1 and
+                      rows.nearest_threads(8) == 4 and rows.nearest_threads(0) == 0);
+    correct.push_back(rows.peak_gflops(1) == 2.0 and rows.peak_gflops(4) == 8.0 and rows.peak_gflops() == 8.0);
+    correct.push_back(rows.attainable_gflops(0.1, "DRAM", 1) == 1.0 and rows.attainable_gflops(0.1, "DRAM", 4) == 3.0);
+
+    // Save where the Runner looks for it
+    const auto path = roofline_path();
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream(path) << roof;
+    std::cout << "Roofline written to " << path.string() << std::endl;
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
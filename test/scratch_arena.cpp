@@ -0,0 +1,200 @@
+/**
+ * \file       scratch_arena.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <execution>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/arena_algorithm.hpp"
+#include "xstd/scratch_arena.hpp"
+
+//
+// Count every call to the global operator new
+//
+static std::atomic<std::size_t> allocation_count(0);
+
+void* operator new(std::size_t bytes) {
+    ++allocation_count;
+    if (void* ptr = std::malloc(bytes ? bytes : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t bytes, std::align_val_t alignment) {
+    ++allocation_count;
+    const auto align = static_cast<std::size_t>(alignment);
+    if (void* ptr = std::aligned_alloc(align, ((bytes + align - 1) / align) * align)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+/// Frees memory of the replaced operator new (not inlined so GCC
+/// does not flag free() of new'd memory with -Wmismatched-new-delete)
+[[gnu::noinline]] void release(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr) noexcept { release(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { release(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { release(ptr); }
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { release(ptr); }
+
+/** Algorithms to compare with and without an arena
+ */
+enum class algorithm { sort, scan, merge };
+
+/** Functor to Time
+ *
+ * Performs sort, scan or merge either with the std::
+ * algorithm or with the xstd:: version taking temporaries
+ * from a scratch arena.  The arena is reset between runs as
+ * it would be at the start of every time step.  The number of
+ * calls to operator new made by each timed run is recorded.
+ */
+template <algorithm Algorithm, bool UseArena>
+class ARENA_ALGORITHM {
+   public:
+    using T = double;
+
+    /** Construct the functor
+     */
+    ARENA_ALGORITHM(const std::vector<T>& x) : x_(x), temp_(x.size()), answer_(x.size()) {
+        if constexpr (Algorithm == algorithm::sort) {
+            std::copy(x_.begin(), x_.end(), answer_.begin());
+            std::sort(answer_.begin(), answer_.end());
+        } else if constexpr (Algorithm == algorithm::scan) {
+            std::inclusive_scan(x_.begin(), x_.end(), answer_.begin());
+        } else {
+            const auto mid = x_.begin() + x_.size() / 2;
+            std::sort(x_.begin(), mid);
+            std::sort(mid, x_.end());
+            std::merge(x_.begin(), mid, mid, x_.end(), answer_.begin());
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() {
+        arena_.reset();
+        if constexpr (Algorithm == algorithm::sort) {
+            std::copy(x_.begin(), x_.end(), temp_.begin());
+        }
+    }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        const auto count = allocation_count.load();
+        const auto mid   = x_.begin() + x_.size() / 2;
+        if constexpr (Algorithm == algorithm::sort and UseArena) {
+            xstd::sort(policy, temp_.begin(), temp_.end(), arena_);
+        } else if constexpr (Algorithm == algorithm::sort) {
+            std::sort(policy, temp_.begin(), temp_.end());
+        } else if constexpr (Algorithm == algorithm::scan and UseArena) {
+            xstd::inclusive_scan(policy, x_.begin(), x_.end(), temp_.begin(), arena_);
+        } else if constexpr (Algorithm == algorithm::scan) {
+            std::inclusive_scan(policy, x_.begin(), x_.end(), temp_.begin());
+        } else if constexpr (UseArena) {
+            xstd::merge(policy, x_.begin(), mid, mid, x_.end(), temp_.begin(), arena_);
+        } else {
+            std::merge(policy, x_.begin(), mid, mid, x_.end(), temp_.begin());
+        }
+        allocations_ += allocation_count.load() - count;
+        ++calls_;
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() {
+        if constexpr (Algorithm == algorithm::scan) {
+            // Blocked scan rounds differently than a serial scan
+            return std::equal(answer_.begin(), answer_.end(), temp_.begin(),
+                              [](auto a, auto b) { return std::abs(a - b) <= 1.0e-12 * std::abs(a); });
+        } else {
+            return std::equal(answer_.begin(), answer_.end(), temp_.begin());
+        }
+    }
+
+    /** Display allocations per call and clear the counters
+     */
+    void print_allocations() {
+        std::cout << "  Allocations per Call = " << std::defaultfloat << double(allocations_) / calls_;
+        if constexpr (UseArena) {
+            std::cout << "  Arena Capacity (bytes) = " << arena_.capacity();
+            std::cout << "  Arena Blocks = " << arena_.system_allocations();
+        }
+        std::cout << std::endl;
+        allocations_ = 0;
+        calls_       = 0;
+    }
+
+   private:
+    std::vector<T> x_;
+    std::vector<T> temp_;
+    std::vector<T> answer_;
+    xstd::scratch_arena arena_;
+    std::size_t allocations_ = 0;
+    std::size_t calls_       = 0;
+};
+
+/** Time functor under seq and par
+ */
+template <std::size_t NCYLCE, typename Functor>
+bool run_all(const std::string& name, Functor&& op) {
+    std::vector<bool> correct;
+
+    std::cout << name << ": std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+    op.print_allocations();
+
+    std::cout << name << ": std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+    op.print_allocations();
+
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;       // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 4000000;  // Length of Vectors
+
+    // Data for problem
+    std::vector<Real> x(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+
+    // Calculate Timings
+    correct.push_back(run_all<NCYLCE>("std::sort", ARENA_ALGORITHM<algorithm::sort, false>(x)));
+    correct.push_back(run_all<NCYLCE>("xstd::sort + arena", ARENA_ALGORITHM<algorithm::sort, true>(x)));
+    correct.push_back(run_all<NCYLCE>("std::inclusive_scan", ARENA_ALGORITHM<algorithm::scan, false>(x)));
+    correct.push_back(run_all<NCYLCE>("xstd::inclusive_scan + arena", ARENA_ALGORITHM<algorithm::scan, true>(x)));
+    correct.push_back(run_all<NCYLCE>("std::merge", ARENA_ALGORITHM<algorithm::merge, false>(x)));
+    correct.push_back(run_all<NCYLCE>("xstd::merge + arena", ARENA_ALGORITHM<algorithm::merge, true>(x)));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
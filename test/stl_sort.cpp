@@ -69,7 +69,7 @@ int main() {
     std::vector<bool> correct;
 
     // Initialize Data
-    random_fill(x);
+    cached_random_fill(x, 1);
 
     // Create Functor
     SORT<Real> op(x);
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "helpers.hpp"
+#include "xstd/simd.hpp"
 
 /** Functor to Time
  */
@@ -41,6 +42,31 @@ class SAXPY {
                        [a = this->a_](auto xi, auto yi) { return yi + (a * xi); });
     }
 
+    /** Perform timed calculation using explicit SIMD
+     *
+     * Scalar peel until y is aligned, aligned vector main loop
+     * then a masked remainder.
+     */
+    void operator()(const xstd::execution::simd_policy) {
+        using pack        = xstd::simd_pack<T>;
+        const T* x        = x_.data();
+        T* y              = temp_.data();
+        const auto n      = x_.size();
+        const auto peel   = xstd::simd_peel<pack::alignment>(y, n);
+        const pack a      = pack::broadcast(a_);
+
+        std::size_t i = 0;
+        for (; i < peel; ++i) {
+            y[i] += a_ * x[i];
+        }
+        for (; i + pack::size <= n; i += pack::size) {
+            (pack::load_aligned(y + i) + a * pack::load(x + i)).store_aligned(y + i);
+        }
+        if (i < n) {
+            (pack::load_partial(y + i, n - i) + a * pack::load_partial(x + i, n - i)).store_partial(y + i, n - i);
+        }
+    }
+
     /** Check for correct solution
      *
      * Checks the calculated results against the true solution
@@ -50,6 +76,14 @@ class SAXPY {
      */
     bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
 
+    /** Floating point operations of one run (multiply and add)
+     */
+    double flops() const { return 2.0 * x_.size(); }
+
+    /** Bytes moved by one run (read x and y, write y)
+     */
+    double bytes() const { return 3.0 * sizeof(T) * x_.size(); }
+
    private:
     T a_;
     std::vector<T> x_;
@@ -73,8 +107,8 @@ int main() {
     std::vector<bool> correct;
 
     // Initialize Data
-    random_fill(x);
-    random_fill(y);
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
 
     // Create Functor
     SAXPY<Real> op(a, x, y);
@@ -92,5 +126,8 @@ int main() {
     std::cout << "std::execution::par_unseq\n";
     correct.push_back( Runner::execute<NCYLCE>(std::execution::par_unseq, op) );
 
+    std::cout << "xstd::execution::simd\n";
+    correct.push_back( Runner::execute<NCYLCE>(xstd::execution::simd, op) );
+
     return not std::all_of(correct.begin(), correct.end(), [](auto val){return val;});
 }
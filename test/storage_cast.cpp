@@ -0,0 +1,171 @@
+/**
+ * \file       storage_cast.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/storage_cast.hpp"
+#include "xstd/strided.hpp"
+#include "xstd/zip.hpp"
+
+/** How the storage views are passed to the algorithm
+ */
+enum class adaptor { transform, zip, strided };
+
+/** Functor to Time
+ *
+ * SAXPY with x and y stored as Storage but computed in double
+ * through storage_cast views.  The answer applies the same
+ * conversions serially so the check is exact.  The error of
+ * the narrow storage is measured against the SAXPY computed
+ * and stored entirely in double.
+ */
+template <typename Storage, adaptor Adaptor>
+class STORAGE_SAXPY {
+   public:
+    using T = double;
+
+    /** Construct the functor
+     */
+    STORAGE_SAXPY(const T a, const std::vector<T>& x, const std::vector<T>& y)
+        : a_(a), x_(x.size()), y_(y.size()), temp_(y.size()), answer_(y.size()), exact_(y) {
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            x_[i]      = Storage(x[i]);
+            y_[i]      = Storage(y[i]);
+            answer_[i] = Storage(T(y_[i]) + (a_ * T(x_[i])));
+            exact_[i] += (a_ * x[i]);
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { std::copy(y_.begin(), y_.end(), temp_.begin()); }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        auto wx = xstd::storage_cast<T>(x_);
+        auto wy = xstd::storage_cast<T>(temp_);
+        if constexpr (Adaptor == adaptor::transform) {
+            std::transform(policy, wx.begin(), wx.end(), wy.begin(), wy.begin(),
+                           [a = this->a_](T xval, T yval) { return yval + (a * xval); });
+        } else if constexpr (Adaptor == adaptor::zip) {
+            auto zit = xstd::zip(wx, wy);
+            std::for_each(policy, zit.begin(), zit.end(),
+                          [a = this->a_](auto vp) { std::get<1>(vp) += a * std::get<0>(vp); });
+        } else {
+            auto sx = xstd::strided(wx, 1);
+            auto sy = xstd::strided(wy, 1);
+            std::transform(policy, sx.begin(), sx.end(), sy.begin(), sy.begin(),
+                           [a = this->a_](T xval, T yval) { return yval + (a * xval); });
+        }
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() {
+        return std::equal(answer_.begin(), answer_.end(), temp_.begin(),
+                          [](const Storage& a, const Storage& b) { return T(a) == T(b); });
+    }
+
+    /** Floating point operations of one run (multiply and add)
+     */
+    double flops() const { return 2.0 * x_.size(); }
+
+    /** Bytes moved by one run (read x and y, write y as Storage)
+     */
+    double bytes() const { return 3.0 * sizeof(Storage) * x_.size(); }
+
+    /** Largest error relative to the result computed in double
+     */
+    T max_relative_error() const {
+        T error = 0;
+        for (std::size_t i = 0; i < exact_.size(); ++i) {
+            error = std::max(error, std::abs(T(temp_[i]) - exact_[i]) / std::abs(exact_[i]));
+        }
+        return error;
+    }
+
+   private:
+    T a_;
+    std::vector<Storage> x_;
+    std::vector<Storage> y_;
+    std::vector<Storage> temp_;
+    std::vector<Storage> answer_;
+    std::vector<T> exact_;
+};
+
+/** Time all policies for a storage type and adaptor
+ */
+template <std::size_t NCYLCE, typename Storage, adaptor Adaptor>
+bool run_all(const std::string& name, STORAGE_SAXPY<Storage, Adaptor> op) {
+    std::vector<bool> correct;
+
+    std::cout << name << ": std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+
+    std::cout << name << ": std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, op));
+
+    std::cout << name << ": std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+
+    std::cout << name << ": std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, op));
+
+    std::cout << name << ": Max Relative Error = " << std::defaultfloat << op.max_relative_error() << std::endl;
+
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+/** Time every adaptor for a storage type
+ */
+template <std::size_t NCYLCE, typename Storage>
+bool run_storage(const std::string& name, const double a, const std::vector<double>& x,
+                 const std::vector<double>& y) {
+    std::vector<bool> correct;
+    correct.push_back(run_all<NCYLCE>(name + " transform", STORAGE_SAXPY<Storage, adaptor::transform>(a, x, y)));
+    correct.push_back(run_all<NCYLCE>(name + " zip", STORAGE_SAXPY<Storage, adaptor::zip>(a, x, y)));
+    correct.push_back(run_all<NCYLCE>(name + " strided", STORAGE_SAXPY<Storage, adaptor::strided>(a, x, y)));
+    return std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real                   = double;
+    constexpr std::size_t NCYLCE = 10;        // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 20000000;  // Length of Vectors
+
+    // Data for problem
+    const Real a(5);
+    std::vector<Real> x(NSIZE);
+    std::vector<Real> y(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
+
+    // Calculate Timings
+    correct.push_back(run_storage<NCYLCE, double>("double", a, x, y));
+    correct.push_back(run_storage<NCYLCE, float>("float", a, x, y));
+    correct.push_back(run_storage<NCYLCE, xstd::bfloat16>("bfloat16", a, x, y));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
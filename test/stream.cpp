@@ -0,0 +1,142 @@
+/**
+ * \file       stream.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <filesystem>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/mmap_array.hpp"
+#include "xstd/stop_watch.hpp"
+#include "xstd/stream.hpp"
+
+/** Point wise function applied by the transform
+ */
+inline double convert(const double x) { return std::sqrt(x) * 2.0 + 1.0; }
+
+/** Functor to Time
+ *
+ * Streams a file through a transform writing a second file
+ * or through a reduction.  Also times itself to report the
+ * end to end bandwidth (bytes read + bytes written per second).
+ */
+class STREAM {
+   public:
+    using T = double;
+
+    /** Construct the functor
+     */
+    STREAM(const std::string& input, const std::string& output, const std::size_t buffers, const bool reduce)
+        : stream_(input, 0, buffers), output_(output), reduce_(reduce) {
+        xstd::mmap_array<const T> values(input);
+        answer_ = std::transform_reduce(values.begin(), values.end(), T(0), std::plus<>(), convert);
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() {
+        sum_ = 0;
+        std::filesystem::remove(output_);
+    }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        watch_.start();
+        if (reduce_) {
+            sum_ = stream_.transform_reduce(policy, T(0), std::plus<>(), convert);
+        } else {
+            stream_.transform(policy, output_, convert);
+        }
+        watch_.stop();
+        bytes_ += stream_.size() * sizeof(T) * (reduce_ ? 1 : 2);
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() {
+        if (not reduce_) {
+            xstd::mmap_array<const T> values(output_);
+            sum_ = std::reduce(values.begin(), values.end());
+        }
+        return std::abs(sum_ - answer_) <= 1.0e-10 * std::abs(answer_);
+    }
+
+    /** Display bandwidth of all timed runs and clear it
+     */
+    void print_bandwidth() {
+        std::cout << "  Bandwidth (GB/s) = " << std::defaultfloat << bytes_ / watch_.elapsed_seconds() / 1.0e9
+                  << std::endl;
+        watch_.reset();
+        bytes_ = 0;
+    }
+
+   private:
+    xstd::stream<T> stream_;
+    std::string output_;
+    bool reduce_;
+    T answer_;
+    T sum_;
+    xstd::StopWatch watch_;
+    double bytes_ = 0;
+};
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 5;         // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 50000000;  // Length of file
+
+    // Data for problem
+    const auto dir    = std::filesystem::temp_directory_path();
+    const auto input  = (dir / "pstl_stream_in.bin").string();
+    const auto output = (dir / "pstl_stream_out.bin").string();
+    std::vector<bool> correct;
+
+    // Initialize Data
+    {
+        std::vector<Real> x(NSIZE);
+        cached_random_fill(x, 1);
+        xstd::mmap_array<Real> file(input, NSIZE);
+        std::copy(x.begin(), x.end(), file.begin());
+    }
+
+    for (bool reduce : {false, true}) {
+        for (std::size_t buffers : {1, 3}) {
+            const std::string name = std::string(reduce ? "transform_reduce" : "transform") +
+                                     " (Buffers = " + std::to_string(buffers) + ")";
+
+            // Create Functor
+            STREAM op(input, output, buffers, reduce);
+
+            // Calculate Timings
+            std::cout << name << ": std::execution::seq\n";
+            correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+            op.print_bandwidth();
+
+            std::cout << name << ": std::execution::par\n";
+            correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+            op.print_bandwidth();
+        }
+    }
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
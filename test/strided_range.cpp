@@ -63,6 +63,20 @@ class STRIDED_SAXPY {
      */
     bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
 
+    /** Floating point operations of one run (multiply and add)
+     */
+    double flops() const { return 2.0 * std::min(x_.size() / incx_, y_.size() / incy_); }
+
+    /** Bytes moved by one run (read x and y, write y)
+     *
+     * Whole cache lines are moved so strides shorter than a line
+     * also move the values skipped over.
+     */
+    double bytes() const {
+        constexpr std::ptrdiff_t line = 64 / sizeof(T);
+        return 0.5 * this->flops() * sizeof(T) * (std::min(incx_, line) + 2 * std::min(incy_, line));
+    }
+
    private:
     std::ptrdiff_t incx_;
     std::ptrdiff_t incy_;
@@ -90,8 +104,8 @@ int main() {
     std::vector<bool> correct;
 
     // Initialize Data
-    random_fill(x);
-    random_fill(y);
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
 
     // Create Functor
     STRIDED_SAXPY<Real> op(a, x, INCX, y, INCY);
@@ -5,11 +5,13 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <execution>
 #include <iostream>
 #include <vector>
 
 #include "helpers.hpp"
+#include "xstd/simd.hpp"
 #include "xstd/strided.hpp"
 
 /** Functor to Time
@@ -49,14 +51,64 @@ class STRIDED_SAXPY {
                        [a = this->a_](auto xval, auto yval) { return yval + (a * xval); });
     }
 
+    /** Perform timed calculation using explicit SIMD
+     *
+     * Strided values are gathered into packs and scattered
+     * back with a masked remainder for the final partial pack.
+     * Without vector gather/scatter instructions (see the label
+     * printed by main) these are one scalar access per lane.
+     */
+    void operator()(const xstd::execution::simd_policy) {
+        using pack   = xstd::simd_pack<T>;
+        auto x_iter  = xstd::strided(x_, incx_);
+        auto y_iter  = xstd::strided(temp_, incy_);
+        const auto n = static_cast<std::size_t>(std::min(x_iter.size(), y_iter.size()));
+        const T* x   = x_.data();
+        T* y         = temp_.data();
+        const pack a = pack::broadcast(a_);
+
+        const auto incx = incx_;
+        const auto incy = incy_;
+        std::size_t i   = 0;
+        for (; i + pack::size <= n; i += pack::size) {
+            T* yi = y + static_cast<std::ptrdiff_t>(i) * incy;
+            (pack::gather(yi, incy) + a * pack::gather(x + static_cast<std::ptrdiff_t>(i) * incx, incx)).scatter(yi, incy);
+        }
+        if (i < n) {
+            T* yi = y + static_cast<std::ptrdiff_t>(i) * incy;
+            (pack::gather_partial(yi, incy, n - i) + a * pack::gather_partial(x + static_cast<std::ptrdiff_t>(i) * incx, incx, n - i))
+                .scatter_partial(yi, incy, n - i);
+        }
+    }
+
     /** Check for correct solution
      *
      * Checks the calculated results against the true solution
      * previously calculated during construction.
      *
+     * Kernels may contract y + a * x into an FMA differently so
+     * values only need to match to rounding.
+     *
      * This should NOT be timed.
      */
-    bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
+    bool check() {
+        return std::equal(answer_.begin(), answer_.end(), temp_.begin(),
+                          [](T u, T v) { return std::abs(u - v) <= T(1.0e-12) * std::abs(u); });
+    }
+
+    /** Floating point operations of one run (multiply and add)
+     */
+    double flops() const { return 2.0 * std::min(x_.size() / incx_, y_.size() / incy_); }
+
+    /** Bytes moved by one run (read x and y, write y)
+     *
+     * Whole cache lines are moved so strides shorter than a line
+     * also move the values skipped over.
+     */
+    double bytes() const {
+        constexpr std::ptrdiff_t line = 64 / sizeof(T);
+        return 0.5 * this->flops() * sizeof(T) * (std::min(incx_, line) + 2 * std::min(incy_, line));
+    }
 
    private:
     std::ptrdiff_t incx_;
@@ -85,8 +137,8 @@ int main() {
     std::vector<bool> correct;
 
     // Initialize Data
-    random_fill(x);
-    random_fill(y);
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
 
     // Create Functor
     STRIDED_SAXPY<Real> op(a, x, INCX, y, INCY);
@@ -104,5 +156,10 @@ int main() {
     std::cout << "std::execution::par_unseq\n";
     correct.push_back( Runner::execute<NCYLCE>(std::execution::par_unseq, op) );
 
+    using pack = xstd::simd_pack<Real>;
+    std::cout << "xstd::execution::simd (gather: " << (pack::hardware_gather ? "vector" : "scalar")
+              << ", scatter: " << (pack::hardware_scatter ? "vector" : "scalar") << ")\n";
+    correct.push_back( Runner::execute<NCYLCE>(xstd::execution::simd, op) );
+
     return not std::all_of(correct.begin(), correct.end(), [](auto val){return val;});
 }
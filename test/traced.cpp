@@ -0,0 +1,172 @@
+/**
+ * \file       traced.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/arena_algorithm.hpp"
+#include "xstd/scratch_arena.hpp"
+#include "xstd/traced.hpp"
+
+/** Functor to Time
+ *
+ * SAXPY followed by the sum of the result with both algorithm
+ * calls traced under their own region names.  Counts its own
+ * calls so the totals of the trace registry can be checked.
+ */
+template <typename T>
+class TRACED_SAXPY {
+   public:
+    /** Construct the functor
+     */
+    TRACED_SAXPY(const T a, const std::vector<T>& x, const std::vector<T>& y)
+        : a_(a), x_(x), y_(y), temp_(y.size()), answer_(y) {
+        for (std::size_t i = 0; i < x_.size(); ++i) {
+            answer_[i] += (a_ * x_[i]);
+        }
+        sum_answer_ = std::accumulate(answer_.begin(), answer_.end(), T(0));
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() {
+        std::copy(y_.begin(), y_.end(), temp_.begin());
+        sum_ = 0;
+    }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        using xstd::execution::traced;
+        xstd::transform(traced(policy, "saxpy"), x_.begin(), x_.end(), temp_.begin(), temp_.begin(),
+                        [a = this->a_](T xval, T yval) { return yval + (a * xval); });
+        sum_ = xstd::reduce(traced(policy, "sum"), temp_.begin(), temp_.end(), T(0));
+        ++calls_;
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() {
+        return std::equal(answer_.begin(), answer_.end(), temp_.begin()) and
+               std::abs(sum_ - sum_answer_) <= 1.0e-10 * std::abs(sum_answer_);
+    }
+
+    /** Floating point operations of one run (SAXPY then sum)
+     */
+    double flops() const { return 3.0 * x_.size(); }
+
+    /** Bytes moved by one run (read x and y, write y, read y)
+     */
+    double bytes() const { return 4.0 * sizeof(T) * x_.size(); }
+
+    /** Number of timed calculations performed
+     */
+    std::size_t calls() const { return calls_; }
+
+   private:
+    T a_;
+    std::vector<T> x_;
+    std::vector<T> y_;
+    std::vector<T> temp_;
+    std::vector<T> answer_;
+    T sum_answer_;
+    T sum_              = 0;
+    std::size_t calls_ = 0;
+};
+
+/** Check the arena algorithms accept traced policies
+ *
+ * Each call must give the right result and add one call of
+ * every element to its region.
+ */
+bool check_arena_algorithms(const std::vector<double>& x) {
+    using xstd::execution::traced;
+    xstd::scratch_arena arena;
+    std::vector<double> sorted(x);
+    std::vector<double> scanned(x.size());
+    std::vector<double> merged(x.size());
+
+    xstd::sort(traced(std::execution::par, "arena sort"), sorted.begin(), sorted.end(), arena);
+    arena.reset();
+    xstd::inclusive_scan(traced(std::execution::par, "arena scan"), x.begin(), x.end(), scanned.begin(), arena);
+    arena.reset();
+    const auto mid = sorted.begin() + sorted.size() / 2;
+    xstd::merge(traced(std::execution::par, "arena merge"), sorted.begin(), mid, mid, sorted.end(), merged.begin(),
+                arena);
+
+    const double sum = std::accumulate(x.begin(), x.end(), 0.0);
+    bool ok = std::is_sorted(sorted.begin(), sorted.end()) and std::is_sorted(merged.begin(), merged.end()) and
+              std::abs(scanned.back() - sum) <= 1.0e-10 * std::abs(sum);
+    const auto entries = xstd::trace_registry::instance().entries();
+    for (const char* name : {"arena sort", "arena scan", "arena merge"}) {
+        const auto found = entries.find(name);
+        ok = ok and (found != entries.end()) and (found->second.calls == 1) and (found->second.elements == x.size());
+    }
+    std::cout << "Arena algorithms: Correct = " << std::boolalpha << ok << std::endl;
+    return ok;
+}
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;        // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 20000000;  // Length of Vectors
+
+    // Data for problem
+    const Real a(5);
+    std::vector<Real> x(NSIZE);
+    std::vector<Real> y(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
+
+    // Create Functor
+    TRACED_SAXPY<Real> op(a, x, y);
+
+    // Calculate Timings
+    std::cout << "std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, op));
+
+    std::cout << "std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, op));
+
+    std::cout << "std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, op));
+
+    std::cout << "std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, op));
+
+    // Every traced call must be in the registry
+    const auto entries = xstd::trace_registry::instance().entries();
+    for (const char* name : {"saxpy", "sum"}) {
+        const auto found = entries.find(name);
+        const bool ok    = (found != entries.end()) and (found->second.calls == op.calls()) and
+                        (found->second.elements == op.calls() * NSIZE) and (found->second.seconds > 0);
+        std::cout << "Region " << name << ": Correct = " << std::boolalpha << ok << std::endl;
+        correct.push_back(ok);
+    }
+
+    // Algorithms taking an arena unwrap the traced policy too
+    correct.push_back(check_arena_algorithms(std::vector<Real>(x.begin(), x.begin() + NSIZE / 16)));
+
+    // Report is printed at exit
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
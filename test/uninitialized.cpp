@@ -0,0 +1,160 @@
+/**
+ * \file       uninitialized.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <execution>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/uninitialized.hpp"
+
+/** Functor to Time
+ *
+ * Setup of a fresh buffer holding a constant value.
+ * Each timed run allocates the buffer so the cost of
+ * initialization and first touch page faults are included.
+ */
+template <typename Vector>
+class FILL {
+   public:
+    using value_type = typename Vector::value_type;
+
+    /** Construct the functor
+     */
+    FILL(const std::size_t n, const value_type value) : n_(n), value_(value) {}
+
+    /** Reset for next timed run
+     *
+     * Releases the buffer so the next run faults in new pages.
+     *
+     * This should NOT be timed.
+     */
+    void reset() { Vector().swap(vec_); }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        Vector vec(n_);
+        if constexpr (std::is_same_v<Vector, xstd::uninitialized_vector<value_type>>) {
+            xstd::uninitialized_fill(policy, vec.begin(), vec.end(), value_);
+        } else {
+            std::fill(policy, vec.begin(), vec.end(), value_);
+        }
+        vec_.swap(vec);
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() {
+        return vec_.size() == n_ and std::all_of(vec_.begin(), vec_.end(), [v = value_](auto x) { return x == v; });
+    }
+
+   private:
+    std::size_t n_;
+    value_type value_;
+    Vector vec_;
+};
+
+/** Functor to Time
+ *
+ * Setup of a fresh buffer holding a copy of an input.
+ * Each timed run allocates the buffer so the cost of
+ * initialization and first touch page faults are included.
+ */
+template <typename Vector>
+class COPY {
+   public:
+    using value_type = typename Vector::value_type;
+
+    /** Construct the functor
+     */
+    COPY(const std::vector<value_type>& x) : x_(x) {}
+
+    /** Reset for next timed run
+     *
+     * Releases the buffer so the next run faults in new pages.
+     *
+     * This should NOT be timed.
+     */
+    void reset() { Vector().swap(vec_); }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        Vector vec(x_.size());
+        if constexpr (std::is_same_v<Vector, xstd::uninitialized_vector<value_type>>) {
+            xstd::uninitialized_copy(policy, x_.begin(), x_.end(), vec.begin());
+        } else {
+            std::copy(policy, x_.begin(), x_.end(), vec.begin());
+        }
+        vec_.swap(vec);
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(x_.begin(), x_.end(), vec_.begin(), vec_.end()); }
+
+   private:
+    std::vector<value_type> x_;
+    Vector vec_;
+};
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE = 10;        // Number of time to repeat test
+    constexpr std::size_t NSIZE  = 25000000;  // Length of Vectors
+
+    // Data for problem
+    std::vector<Real> x(NSIZE);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(x, 1);
+
+    // Create Functors
+    FILL<std::vector<Real>> value_fill(NSIZE, Real(1));
+    FILL<xstd::uninitialized_vector<Real>> default_fill(NSIZE, Real(1));
+    COPY<std::vector<Real>> value_copy(x);
+    COPY<xstd::uninitialized_vector<Real>> default_copy(x);
+
+    // Calculate Timings
+    std::cout << "std::vector + std::fill: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, value_fill));
+
+    std::cout << "std::vector + std::fill: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, value_fill));
+
+    std::cout << "xstd::uninitialized_vector + xstd::uninitialized_fill: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, default_fill));
+
+    std::cout << "xstd::uninitialized_vector + xstd::uninitialized_fill: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, default_fill));
+
+    std::cout << "std::vector + std::copy: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, value_copy));
+
+    std::cout << "std::vector + std::copy: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, value_copy));
+
+    std::cout << "xstd::uninitialized_vector + xstd::uninitialized_copy: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, default_copy));
+
+    std::cout << "xstd::uninitialized_vector + xstd::uninitialized_copy: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, default_copy));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
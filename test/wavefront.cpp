@@ -0,0 +1,132 @@
+/**
+ * \file       wavefront.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <execution>
+#include <iostream>
+#include <vector>
+
+#include "helpers.hpp"
+#include "xstd/wavefront.hpp"
+
+/** Functor to Time
+ *
+ * One Gauss-Seidel sweep of the 2-D Poisson equation
+ * on the interior points of a NxN grid.
+ */
+template <typename T>
+class GAUSS_SEIDEL {
+   public:
+    /** Construct the functor
+     *
+     * The answer is a serial lexicographic sweep which the
+     * wavefront ordering must reproduce exactly.
+     */
+    GAUSS_SEIDEL(const std::ptrdiff_t n, const xstd::nd_extent<2>& tile, const std::vector<T>& u,
+                 const std::vector<T>& rhs)
+        : n_(n), tile_(tile), u_(u), rhs_(rhs), answer_(u) {
+        for (std::ptrdiff_t i = 1; i < n_ - 1; ++i) {
+            for (std::ptrdiff_t j = 1; j < n_ - 1; ++j) {
+                update(answer_.data(), i, j);
+            }
+        }
+    }
+
+    /** Reset for next timed run
+     *
+     * This should NOT be timed.
+     */
+    void reset() { temp_ = u_; }
+
+    /** Perform timed calculation
+     */
+    template <typename Policy>
+    void operator()(const Policy policy) {
+        T* u = temp_.data();
+        xstd::wavefront_for_each(policy, xstd::nd_extent<2>{n_ - 2, n_ - 2}, tile_,
+                                 [this, u](auto i, auto j) { this->update(u, i + 1, j + 1); });
+    }
+
+    /** Check for correct solution
+     *
+     * This should NOT be timed.
+     */
+    bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
+
+    /** Floating point operations of one run (5 per interior point)
+     */
+    double flops() const { return 5.0 * double((n_ - 2) * (n_ - 2)); }
+
+    /** Bytes of one run moving u (read and write) and rhs once
+     *
+     * The compulsory traffic, a lower bound when the sweep
+     * reloads lines evicted between uses.
+     */
+    double bytes() const { return 3.0 * sizeof(T) * double(u_.size()); }
+
+   private:
+    std::ptrdiff_t n_;
+    xstd::nd_extent<2> tile_;
+    std::vector<T> u_;
+    std::vector<T> rhs_;
+    std::vector<T> temp_;
+    std::vector<T> answer_;
+
+    void update(T* u, const std::ptrdiff_t i, const std::ptrdiff_t j) const {
+        const auto ij = i * n_ + j;
+        u[ij]         = T(0.25) * (u[ij - n_] + u[ij + n_] + u[ij - 1] + u[ij + 1] - rhs_[ij]);
+    }
+};
+
+//
+// MAIN Function
+//
+int main() {
+    using Real = double;
+    constexpr std::size_t NCYLCE  = 10;    // Number of time to repeat test
+    constexpr std::ptrdiff_t NDIM = 2048;  // Grid points in each direction
+    constexpr std::ptrdiff_t TILE = 64;    // Tile size in each direction
+
+    // Data for problem
+    std::vector<Real> u(NDIM * NDIM);
+    std::vector<Real> rhs(NDIM * NDIM);
+    std::vector<bool> correct;
+
+    // Initialize Data
+    cached_random_fill(u, 1);
+    cached_random_fill(rhs, 2);
+
+    // Create Functors
+    GAUSS_SEIDEL<Real> point(NDIM, {1, 1}, u, rhs);
+    GAUSS_SEIDEL<Real> tiled(NDIM, {TILE, TILE}, u, rhs);
+
+    // Calculate Timings
+    std::cout << "Points: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, point));
+
+    std::cout << "Points: std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, point));
+
+    std::cout << "Points: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, point));
+
+    std::cout << "Points: std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, point));
+
+    std::cout << "Tiles: std::execution::seq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::seq, tiled));
+
+    std::cout << "Tiles: std::execution::unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::unseq, tiled));
+
+    std::cout << "Tiles: std::execution::par\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par, tiled));
+
+    std::cout << "Tiles: std::execution::par_unseq\n";
+    correct.push_back(Runner::execute<NCYLCE>(std::execution::par_unseq, tiled));
+
+    return not std::all_of(correct.begin(), correct.end(), [](auto val) { return val; });
+}
@@ -29,7 +29,7 @@ int main() {
     std::vector<Real> y;
 
     // Initialize Data
-    random_fill(x);
+    cached_random_fill(x, 1);
     y = x;
 
     // Calculate answer on the Device (GPU)
@@ -7,9 +7,11 @@
 #include <algorithm>
 #include <execution>
 #include <iostream>
+#include <type_traits>
 #include <vector>
 
 #include "helpers.hpp"
+#include "xstd/simd.hpp"
 #include "xstd/zip.hpp"
 
 /** Functor to Time
@@ -44,6 +46,45 @@ class SAXPY {
         });
     }
 
+    /** Untimed calculation with every element observed
+     *
+     * Shows how the zipped iterators were split across threads.
+     */
+    template <typename Policy, typename = std::enable_if_t<std::is_execution_policy_v<Policy>>>
+    void observed(const Policy policy) {
+        auto zit = xstd::zip(x_, temp_);
+        std::for_each(policy, zit.begin(), zit.end(), xstd::observe([a = this->a_](auto vp) {
+            std::get<1>(vp) += a * std::get<0>(vp);
+        }));
+    }
+
+    /** Perform timed calculation using explicit SIMD
+     *
+     * Recovers the contiguous storage behind the zipped
+     * iterators then uses a scalar peel until y is aligned,
+     * aligned vector main loop and a masked remainder.
+     */
+    void operator()(const xstd::execution::simd_policy) {
+        using pack      = xstd::simd_pack<T>;
+        auto zit        = xstd::zip(x_, temp_);
+        const auto n    = static_cast<std::size_t>(zit.end() - zit.begin());
+        const T* x      = &std::get<0>(*zit.begin());
+        T* y            = &std::get<1>(*zit.begin());
+        const auto peel = xstd::simd_peel<pack::alignment>(y, n);
+        const pack a    = pack::broadcast(a_);
+
+        std::size_t i = 0;
+        for (; i < peel; ++i) {
+            y[i] += a_ * x[i];
+        }
+        for (; i + pack::size <= n; i += pack::size) {
+            (pack::load_aligned(y + i) + a * pack::load(x + i)).store_aligned(y + i);
+        }
+        if (i < n) {
+            (pack::load_partial(y + i, n - i) + a * pack::load_partial(x + i, n - i)).store_partial(y + i, n - i);
+        }
+    }
+
     /** Check for correct solution
      *
      * Checks the calculated results against the true solution
@@ -53,6 +94,14 @@ class SAXPY {
      */
     bool check() { return std::equal(answer_.begin(), answer_.end(), temp_.begin()); }
 
+    /** Floating point operations of one run (multiply and add)
+     */
+    double flops() const { return 2.0 * x_.size(); }
+
+    /** Bytes moved by one run (read x and y, write y)
+     */
+    double bytes() const { return 3.0 * sizeof(T) * x_.size(); }
+
    private:
     T a_;
     std::vector<T> x_;
@@ -76,8 +125,8 @@ int main() {
     std::vector<bool> correct;
 
     // Initialize Data
-    random_fill(x);
-    random_fill(y);
+    cached_random_fill(x, 1);
+    cached_random_fill(y, 2);
 
     // Create Functor
     SAXPY<Real> op(a, x, y);
@@ -95,5 +144,8 @@ int main() {
     std::cout << "std::execution::par_unseq\n";
     correct.push_back( Runner::execute<NCYLCE>(std::execution::par_unseq, op) );
 
+    std::cout << "xstd::execution::simd\n";
+    correct.push_back( Runner::execute<NCYLCE>(xstd::execution::simd, op) );
+
     return not std::all_of(correct.begin(), correct.end(), [](auto val){return val;});
 }